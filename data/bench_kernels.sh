@@ -0,0 +1,251 @@
+#!/bin/bash
+# Benchmark image kernels in data tools.
+#
+# Usage:
+#
+#   ./bench_kernels.sh [--sizes "{size}..."] [--threads "{n}..."] \
+#                      [--repeat {n}] \
+#                      [--baseline {results.csv} [--tolerance {ratio}]]
+#
+# Each tool is run on synthetic square images of the listed sizes
+# (default "256 1024 4096 8192"), with input and output in raw GA8 format
+# (see image_io.h) so that PNG encoding and decoding are excluded.  Raw
+# inputs are memory-mapped, and outputs are written to /dev/null.  Each
+# run is repeated {n} times (default 3), and the fastest is reported.
+# Times include process startup, which dominates at the smallest sizes.
+#
+# Tools with a thread count option are run once for each of the listed
+# thread counts (default "1 4").  Kernel names for thread counts other
+# than 1 get a "_j{n}" suffix, e.g. "fs_dither_j4", so that serial and
+# threaded runs are reported as separate rows.
+#
+# Results are written to stdout as CSV:
+#
+#   kernel,size,megapixels,seconds,megapixels_per_second
+#
+# With "--baseline", results are compared against a previous run of this
+# script.  Any kernel whose throughput drops below {ratio} (default 0.8)
+# times the baseline is reported to stderr, and the script exits with
+# failure status after all kernels have run.
+#
+# Kernels map to tools as follows:
+#
+#   ordered_dither  dither.exe
+#   ordered_dither_png
+#                   dither.exe with PNG output
+#   ordered_dither_packed_png
+#                   dither.exe with "-p" (packed 2bit PNG output)
+#   fs_dither       fs_dither.exe with "-j"
+#   fs_dither_png   fs_dither.exe with PNG output
+#   fs_dither_packed_png
+#                   fs_dither.exe with "-p" (packed 2bit PNG output)
+#   tile_dither     tile_dither.exe with "-j" and 64 pixel tiles
+#   random_dither   random_dither.exe with "-j"
+#   crop            crop_table.exe, 64x64 tiles cropped to 56x56
+#   crop_dither     crop_table.exe with "-d"
+#   triangle_merge  triangle_merge.exe with 64 pixel tiles
+#   wall_map        generate_test_wall_map.exe (cellular automata smoothing,
+#                   flood fill, and 8x8 tile blit), size is output pixels
+#   wall_map_{phase}
+#                   Time spent in each phase of generate_test_wall_map.exe,
+#                   as reported by "--phase-times", e.g. wall_map_smooth
+#                   for cellular automata smoothing, wall_map_flood_fill,
+#                   and wall_map_write_pixels for tile blit plus writing
+#                   output.  These exclude process startup.
+#   floor_map       generate_test_floor_map.exe (64x64 tile blit), size is
+#                   output pixels
+#   floor_map_hash  generate_test_floor_map.exe with "--hash" and
+#                   "--threads"
+#
+# Expected to be run from the data directory after building the tools,
+# e.g. via "make bench".
+
+set -euo pipefail
+
+SIZES="256 1024 4096 8192"
+THREADS="1 4"
+REPEAT=3
+BASELINE=
+TOLERANCE=0.8
+while [[ $# -gt 0 ]]; do
+   case "$1" in
+      --sizes)     SIZES=$2; shift 2 ;;
+      --threads)   THREADS=$2; shift 2 ;;
+      --repeat)    REPEAT=$2; shift 2 ;;
+      --baseline)  BASELINE=$2; shift 2 ;;
+      --tolerance) TOLERANCE=$2; shift 2 ;;
+      *)
+         echo "$0 [--sizes \"{size}...\"] [--threads \"{n}...\"]" \
+              "[--repeat {n}]" \
+              "[--baseline {results.csv} [--tolerance {ratio}]]" >&2
+         exit 1
+         ;;
+   esac
+done
+
+# Make sure repeated runs are not served from the output cache (see
+# tool_cache.h), which would happen if we were run via
+# "make TOOL_CACHE_DIR=... bench".
+unset TOOL_CACHE_DIR
+
+TEST_DIR=$(mktemp -d)
+trap 'rm -rf "$TEST_DIR"' EXIT
+OUTPUT="$TEST_DIR/output.ga8"
+ln -s /dev/null "$OUTPUT"
+PNG_OUTPUT="$TEST_DIR/output.png"
+ln -s /dev/null "$PNG_OUTPUT"
+
+# Write a raw GA8 image filled with random bytes.
+function synthetic_image
+{
+   local width=$1
+   local height=$2
+   local output=$3
+   perl -e 'print "\x89GA8", pack("V3", 1, $ARGV[0], $ARGV[1])' \
+        "$width" "$height" > "$output"
+   head -c $((width * height * 2)) /dev/urandom >> "$output"
+}
+
+# Run a command $REPEAT times and print the fastest time in seconds.
+function best_time
+{
+   local best= start end elapsed i
+   for (( i = 0; i < REPEAT; i++ )); do
+      start=$EPOCHREALTIME
+      "$@" > /dev/null 2>&1 || { echo "Failed: $*" >&2; return 1; }
+      end=$EPOCHREALTIME
+      elapsed=$(awk "BEGIN {printf \"%.6f\", $end - $start}")
+      if [[ -z "$best" ]] || \
+         awk "BEGIN {exit !($elapsed < $best)}"; then
+         best=$elapsed
+      fi
+   done
+   echo "$best"
+}
+
+# Time a single kernel and print one CSV row.
+function bench
+{
+   local kernel=$1
+   local size=$2
+   local seconds
+   shift 2
+   seconds=$(best_time "$@")
+   awk -v k="$kernel" -v s="$size" -v t="$seconds" \
+       'BEGIN {mp = s * s / 1e6;
+               printf "%s,%d,%.3f,%s,%.1f\n", k, s, mp, t, mp / t}'
+}
+
+# Time a tool that reports "phase {name} {microseconds}" lines to stderr,
+# and print one CSV row per phase, using the fastest time for each phase.
+function bench_phases
+{
+   local kernel=$1
+   local size=$2
+   local i
+   shift 2
+   for (( i = 0; i < REPEAT; i++ )); do
+      "$@" 2>&1 > /dev/null | grep '^phase ' \
+         || { echo "Failed: $*" >&2; return 1; }
+   done | awk -v k="$kernel" -v s="$size" '
+      {
+         t = $3 / 1e6;
+         if( !($2 in best) )
+         {
+            order[n++] = $2;
+            best[$2] = t;
+         }
+         else if( t < best[$2] )
+         {
+            best[$2] = t;
+         }
+      }
+      END {
+         mp = s * s / 1e6;
+         for(i = 0; i < n; i++)
+         {
+            t = best[order[i]];
+            printf "%s_%s,%d,%.3f,%.6f,%.1f\n",
+                   k, order[i], s, mp, t, (t > 0 ? mp / t : 0);
+         }
+      }'
+}
+
+# Shared inputs for map generators.
+WALL_TILES="$TEST_DIR/wall_tiles.png"
+./generate_wall_tiles.exe "$WALL_TILES"
+FLOOR_TILES="$TEST_DIR/floor_tiles.ga8"
+synthetic_image 1024 1024 "$FLOOR_TILES"
+
+RESULTS="$TEST_DIR/results.csv"
+echo "kernel,size,megapixels,seconds,megapixels_per_second" | tee "$RESULTS"
+for size in $SIZES; do
+   INPUT="$TEST_DIR/input.ga8"
+   synthetic_image "$size" "$size" "$INPUT"
+   {
+      bench ordered_dither "$size" ./dither.exe "$INPUT" "$OUTPUT"
+      bench ordered_dither_png "$size" \
+         ./dither.exe "$INPUT" "$PNG_OUTPUT"
+      bench ordered_dither_packed_png "$size" \
+         ./dither.exe -p "$INPUT" "$PNG_OUTPUT"
+      bench fs_dither_png "$size" ./fs_dither.exe "$INPUT" "$PNG_OUTPUT"
+      bench fs_dither_packed_png "$size" \
+         ./fs_dither.exe -p "$INPUT" "$PNG_OUTPUT"
+      bench crop "$size" \
+         ./crop_table.exe -i "$INPUT" 64 64 56 56 4 4 "$OUTPUT"
+      bench crop_dither "$size" \
+         ./crop_table.exe -i "$INPUT" -d 64 64 56 56 4 4 "$OUTPUT"
+      bench triangle_merge "$size" \
+         ./triangle_merge.exe 64 "$INPUT" "$INPUT" "$OUTPUT"
+      bench wall_map "$size" \
+         ./generate_test_wall_map.exe --seed 1 \
+            --width $((size / 8)) --height $((size / 8)) \
+            "$WALL_TILES" "$OUTPUT"
+      bench_phases wall_map "$size" \
+         ./generate_test_wall_map.exe --seed 1 --phase-times \
+            --width $((size / 8)) --height $((size / 8)) \
+            "$WALL_TILES" "$OUTPUT"
+      bench floor_map "$size" \
+         ./generate_test_floor_map.exe --seed 1 \
+            --width $((size / 64)) --height $((size / 64)) \
+            "$FLOOR_TILES" "$OUTPUT"
+      for threads in $THREADS; do
+         suffix=
+         if [[ "$threads" -ne 1 ]]; then
+            suffix="_j$threads"
+         fi
+         bench "fs_dither$suffix" "$size" \
+            ./fs_dither.exe -j "$threads" "$INPUT" "$OUTPUT"
+         bench "tile_dither$suffix" "$size" \
+            ./tile_dither.exe -j "$threads" 64 "$INPUT" "$OUTPUT"
+         bench "random_dither$suffix" "$size" \
+            ./random_dither.exe -j "$threads" "$INPUT" "$OUTPUT"
+         bench "floor_map_hash$suffix" "$size" \
+            ./generate_test_floor_map.exe --seed 1 --hash \
+               --threads "$threads" \
+               --width $((size / 64)) --height $((size / 64)) \
+               "$FLOOR_TILES" "$OUTPUT"
+      done
+   } | tee -a "$RESULTS"
+   rm -f "$INPUT"
+done
+
+if [[ -z "$BASELINE" ]]; then
+   exit 0
+fi
+
+# Compare against baseline.  Kernels that are not in the baseline are
+# ignored, so that new kernels can be added without failing old runs.
+awk -F, -v tolerance="$TOLERANCE" '
+   FNR == 1 { next }
+   NR == FNR { baseline[$1 "," $2] = $5; next }
+   ($1 "," $2) in baseline {
+      limit = baseline[$1 "," $2] * tolerance;
+      if( $5 < limit )
+      {
+         printf "%s at %d: %.1f MP/s, baseline %.1f MP/s\n",
+                $1, $2, $5, baseline[$1 "," $2] > "/dev/stderr";
+         failed = 1;
+      }
+   }
+   END { exit failed }' "$BASELINE" "$RESULTS"
@@ -2,137 +2,371 @@
 
    Usage:
 
-      ./crop_table {w0} {h0} {w1} {h1} {x} {y} < {old.png} > {new.png}
+      ./crop_table [-d] {w0} {h0} {w1} {h1} {x} {y} < {old.png} > {new.png}
+      ./crop_table -i {old.png} {crop} {new.png} [{crop} {new.png}...]
 
       {w0} {h0} = old tile size.
       {w1} {h1} = new tile size.
       {x} {y} = offset within the old tile cells
+      {crop} = [-d] {w0} {h0} {w1} {h1} {x} {y}
+
+   The second form applies multiple crops to the same input, writing
+   each to its own output file.  Input is only decoded once, and each
+   scanline is shared by all crops that need it.
+
+   With "-d", cropped pixels are also converted to black and white using
+   ordered dithering.  Dither pattern is keyed on input image coordinates,
+   so output is identical to running dither.exe before crop_table, but
+   only the pixels within the crop windows are dithered, and we avoid the
+   intermediate PNG encode/decode.
+
+   If a crop is contiguous in the input scanline (either there is only a
+   single column of tiles, or tiles are not cropped horizontally) and is
+   not dithered, input rows are passed straight to the writer without
+   copying.
+
+   If TOOL_CACHE_DIR is set, each output is cached separately, keyed on
+   input contents (see tool_cache.h).
 */
 
-#include<png.h>
 #include<stdio.h>
 #include<stdlib.h>
 #include<string.h>
 #include<unistd.h>
+#include"dither_kernels.h"
+#include"image_io.h"
+#include"tool_cache.h"
 
 #ifdef _WIN32
    #include<fcntl.h>
    #include<io.h>
 #endif
 
-/* Shift the pixels in-place. */
-static void CropTilesInPlace(png_image *image, png_bytep pixels,
-                             int w0, int h0, int w1, int h1, int x, int y)
+/* Crop parameters. */
+typedef struct
+{
+   /* Old and new tile sizes. */
+   int w0, h0, w1, h1;
+
+   /* Offset within old tile cells. */
+   int x, y;
+
+   /* If set, apply ordered dithering to cropped pixels. */
+   int dither;
+} CropSpec;
+
+/* Maximum number of crops per invocation. */
+#define MAX_CROPS  16
+
+/* Number of command line arguments for a single crop, not counting "-d"
+   and output filename.                                                 */
+#define CROP_ARG_COUNT  6
+
+/* Output state for a single crop. */
+typedef struct
+{
+   const CropSpec *spec;
+   ImageWriter writer;
+
+   /* Scratch buffer for cropped scanlines, NULL if this crop passes
+      input rows directly to writer.                                 */
+   png_bytep output_row;
+
+   /* Set if writer was opened successfully. */
+   int open;
+} CropJob;
+
+/* Copy the cropped portion of each tile in a single scanline. */
+static void CropRow(png_const_bytep input_row, int input_width,
+                    int w0, int w1, int x, png_bytep output_row)
 {
-   int tile_x, tile_y, cell_y;
-   png_bytep r, w = pixels;
+   int tile_x;
 
-   for(tile_y = 0; tile_y < (int)(image->height) / h0; tile_y++)
+   for(tile_x = 0; tile_x < input_width / w0; tile_x++)
    {
-      for(cell_y = 0; cell_y < h1; cell_y++)
+      memcpy(output_row + tile_x * w1 * 2,
+             input_row + (tile_x * w0 + x) * 2,
+             w1 * 2);
+   }
+}
+
+/* Apply ordered dithering to each cropped tile in a single scanline.
+   "row" is the scanline index in the input image.                    */
+static void DitherCroppedRow(png_bytep output_row, int input_width,
+                             int w0, int w1, int x, int row)
+{
+   int tile_x;
+
+   for(tile_x = 0; tile_x < input_width / w0; tile_x++)
+   {
+      OrderedDitherRow(output_row + tile_x * w1 * 2,
+                       tile_x * w0 + x, row, w1);
+   }
+}
+
+/* Check if cropped pixels of each scanline are contiguous in input. */
+static int IsContiguous(const CropSpec *spec, int input_width)
+{
+   return !spec->dither && (input_width == spec->w0 || spec->w1 == spec->w0);
+}
+
+/* Write one input scanline to a single crop output.  Returns 1 on
+   success, including the case where the scanline is outside of the
+   crop window.                                                      */
+static int WriteCroppedRow(CropJob *job, png_const_bytep input_row,
+                           int input_width, int row)
+{
+   const CropSpec *spec = job->spec;
+   const int cell_y = row % spec->h0;
+
+   if( cell_y < spec->y || cell_y >= spec->y + spec->h1 )
+      return 1;
+
+   if( job->output_row == NULL )
+      return WriteImageRow(&job->writer, input_row + spec->x * 2);
+
+   CropRow(input_row, input_width, spec->w0, spec->w1, spec->x,
+           job->output_row);
+   if( spec->dither )
+   {
+      DitherCroppedRow(job->output_row, input_width,
+                       spec->w0, spec->w1, spec->x, row);
+   }
+   return WriteImageRow(&job->writer, job->output_row);
+}
+
+/* Release output resources for all crops.  Returns zero if all outputs
+   were written successfully.                                          */
+static int CloseCropJobs(CropJob *jobs, int count, int status)
+{
+   int i;
+
+   for(i = 0; i < count; i++)
+   {
+      if( jobs[i].open && !CloseImageWriter(&jobs[i].writer) &&
+          status == 0 )
       {
-         for(tile_x = 0; tile_x < (int)(image->width) / w0; tile_x++)
-         {
-            r = pixels +
-                2 * ((tile_y * h0 + cell_y + y) * image->width +
-                     (tile_x * w0 + x));
-            memmove(w, r, w1 * 2);
-            w += w1 * 2;
-         }
+         fputs("Error writing output\n", stderr);
+         status = 1;
       }
+      free(jobs[i].output_row);
    }
+   return status;
 }
 
-int main(int argc, char **argv)
+/* Apply multiple crops to a single input image.  Returns zero on
+   success.                                                       */
+static int CropTable(const char *input, const char **outputs,
+                     const CropSpec *specs, int count)
 {
-   int w0, h0, w1, h1, x, y;
-   png_image image;
-   png_bytep pixels;
+   CropJob jobs[MAX_CROPS];
+   int row, i, status;
+   ImageReader reader;
+   png_const_bytep input_row;
 
-   /* Check input arguments. */
-   if( argc != 7 )
+   /* Open input.  Since cropping only needs to look at one scanline at a
+      time, we don't need to load the full image here.  Rows are fetched
+      with GetImageRow, so that raw inputs are read in place.            */
+   if( !OpenImageReader(&reader, input) )
    {
-      fprintf(stderr,
-              "%s {w0} {h0} {w1} {h1} {x} {y} < {old.png} > {new.png}\n",
-              *argv);
+      fputs("Error reading input\n", stderr);
       return 1;
    }
 
-   w0 = atoi(argv[1]);
-   h0 = atoi(argv[2]);
-   w1 = atoi(argv[3]);
-   h1 = atoi(argv[4]);
-   x = atoi(argv[5]);
-   y = atoi(argv[6]);
-   if( w0 < 1 || h0 < 1 ||
-       w1 < 1 || h1 < 1 ||
-       x < 0 || y < 0 ||
-       x + w1 > w0 || y + h1 > h0 )
+   /* Open outputs. */
+   memset(jobs, 0, sizeof(jobs));
+   for(i = 0; i < count; i++)
    {
-      fprintf(stderr, "Invalid crop parameters: %dx%d -> %dx%d+%d+%d\n",
-              w0, h0, w1, h1, x, y);
-      return 1;
+      const CropSpec *spec = jobs[i].spec = specs + i;
+
+      if( reader.width % spec->w0 != 0 || reader.height % spec->h0 != 0 )
+      {
+         fprintf(stderr,
+                 "Image dimension is not a multiple of (%d,%d): (%d,%d)\n",
+                 spec->w0, spec->h0, reader.width, reader.height);
+         CloseImageReader(&reader);
+         return CloseCropJobs(jobs, i, 1);
+      }
+      if( !IsContiguous(spec, reader.width) )
+      {
+         jobs[i].output_row =
+            (png_bytep)malloc(reader.width * IMAGE_PIXEL_SIZE);
+         if( jobs[i].output_row == NULL )
+         {
+            fputs("Out of memory", stderr);
+            CloseImageReader(&reader);
+            return CloseCropJobs(jobs, i, 1);
+         }
+      }
+      if( !OpenImageWriter(&jobs[i].writer, outputs[i],
+                           (reader.width / spec->w0) * spec->w1,
+                           (reader.height / spec->h0) * spec->h1) )
+      {
+         fputs("Error writing output\n", stderr);
+         CloseImageReader(&reader);
+         return CloseCropJobs(jobs, i + 1, 1);
+      }
+      jobs[i].open = 1;
    }
 
-   /* Set binary output. */
-   if( isatty(STDOUT_FILENO) )
+   /* Apply crops, writing only the scanlines that are within the crop
+      window of each tile.                                             */
+   for(row = 0; row < reader.height; row++)
    {
-      fputs("Not writing output to stdout because it's a tty\n", stderr);
-      return 1;
+      if( (input_row = GetImageRow(&reader)) == NULL )
+         break;
+      for(i = 0; i < count; i++)
+      {
+         if( !WriteCroppedRow(jobs + i, input_row, reader.width, row) )
+            break;
+      }
+      if( i < count )
+         break;
    }
-   #ifdef _WIN32
-      setmode(STDIN_FILENO, O_BINARY);
-      setmode(STDOUT_FILENO, O_BINARY);
-   #endif
 
-   /* Load input. */
-   memset(&image, 0, sizeof(image));
-   image.version = PNG_IMAGE_VERSION;
-   if( !png_image_begin_read_from_stdio(&image, stdin) )
+   /* Check for errors.  Read errors are reported here, write errors are
+      reported when closing the writers.  Incomplete outputs are removed
+      by CloseImageWriter.                                               */
+   status = 0;
+   if( row < reader.height && reader.current_row == row )
    {
-      fputs("Error reading input\n", stderr);
-      return 1;
+      fputs("Error loading input\n", stderr);
+      status = 1;
    }
-   if( image.width % w0 != 0 || image.height % h0 != 0 )
+   CloseImageReader(&reader);
+   return CloseCropJobs(jobs, count, status);
+}
+
+/* Parse crop parameters from command line.  Returns number of arguments
+   consumed, or zero on error after printing an error message.           */
+static int ParseCropSpec(int argc, char **argv, CropSpec *spec)
+{
+   int i;
+
+   spec->dither = argc > 0 && strcmp(argv[0], "-d") == 0;
+   if( argc < CROP_ARG_COUNT + spec->dither )
+      return 0;
+   for(i = spec->dither; i < CROP_ARG_COUNT + spec->dither; i++)
    {
-      fprintf(stderr,
-              "Image dimension is not a multiple of (%d,%d): (%d,%d)\n",
-              w0, h0, (int)image.width, (int)image.height);
-      return 1;
+      if( argv[i][0] == '-' )
+         return 0;
+   }
+
+   spec->w0 = atoi(argv[spec->dither]);
+   spec->h0 = atoi(argv[1 + spec->dither]);
+   spec->w1 = atoi(argv[2 + spec->dither]);
+   spec->h1 = atoi(argv[3 + spec->dither]);
+   spec->x = atoi(argv[4 + spec->dither]);
+   spec->y = atoi(argv[5 + spec->dither]);
+   if( spec->w0 < 1 || spec->h0 < 1 ||
+       spec->w1 < 1 || spec->h1 < 1 ||
+       spec->x < 0 || spec->y < 0 ||
+       spec->x + spec->w1 > spec->w0 || spec->y + spec->h1 > spec->h0 )
+   {
+      fprintf(stderr, "Invalid crop parameters: %dx%d -> %dx%d+%d+%d\n",
+              spec->w0, spec->h0, spec->w1, spec->h1, spec->x, spec->y);
+      return 0;
+   }
+   return CROP_ARG_COUNT + spec->dither;
+}
+
+static int Usage(const char *program)
+{
+   fprintf(stderr,
+           "%s [-d] {w0} {h0} {w1} {h1} {x} {y} < {old.png} > {new.png}\n"
+           "%s -i {old.png} {crop} {new.png} [{crop} {new.png}...]\n"
+           "  {crop} = [-d] {w0} {h0} {w1} {h1} {x} {y}\n",
+           program, program);
+   return 1;
+}
+
+int main(int argc, char **argv)
+{
+   CropSpec specs[MAX_CROPS];
+   ToolCache caches[MAX_CROPS];
+   const char *input = "-", *outputs[MAX_CROPS];
+   const char *misses[MAX_CROPS];
+   CropSpec miss_specs[MAX_CROPS];
+   char options[128];
+   int count = 0, miss_count = 0, arg, used, i, status;
+
+   /* Check input arguments. */
+   if( argc > 1 && strcmp(argv[1], "-i") == 0 )
+   {
+      if( argc < 3 )
+         return Usage(*argv);
+      input = argv[2];
+      for(arg = 3; arg < argc; arg += used + 1)
+      {
+         if( count == MAX_CROPS )
+         {
+            fprintf(stderr, "Too many crops, maximum is %d\n", MAX_CROPS);
+            return 1;
+         }
+         used = ParseCropSpec(argc - arg, argv + arg, specs + count);
+         if( used == 0 || arg + used >= argc )
+            return Usage(*argv);
+         outputs[count++] = argv[arg + used];
+      }
+      if( count == 0 )
+         return Usage(*argv);
+   }
+   else
+   {
+      used = ParseCropSpec(argc - 1, argv + 1, specs);
+      if( used == 0 || used != argc - 1 )
+         return Usage(*argv);
+      outputs[count++] = "-";
    }
 
-   image.format = PNG_FORMAT_GA;
-   pixels = (png_bytep)malloc(PNG_IMAGE_SIZE(image));
-   if( pixels == NULL )
+   /* Set binary output. */
+   for(i = used = 0; i < count; i++)
+      used += strcmp(outputs[i], "-") == 0;
+   if( used > 1 )
    {
-      fputs("Out of memory", stderr);
+      fputs("Only one output can be written to stdout\n", stderr);
       return 1;
    }
-   if( !png_image_finish_read(&image, NULL, pixels, 0, NULL) )
+   if( used > 0 && isatty(STDOUT_FILENO) )
    {
-      free(pixels);
-      fputs("Error loading input\n", stderr);
+      fputs("Not writing output to stdout because it's a tty\n", stderr);
       return 1;
    }
+   #ifdef _WIN32
+      setmode(STDIN_FILENO, O_BINARY);
+      setmode(STDOUT_FILENO, O_BINARY);
+   #endif
 
-   /* Apply crop. */
-   CropTilesInPlace(&image, pixels, w0, h0, w1, h1, x, y);
-   image.width = (image.width / w0) * w1;
-   image.height = (image.height / h0) * h1;
-
-   /* Write output.  Here we set the flags to optimize for encoding speed
-      rather than output size so that we can iterate faster.  This is fine
-      since the output of this tool are intermediate files that are used
-      only in the build process, and are not the final PNGs that will be
-      committed.                                                           */
-   image.flags |= PNG_IMAGE_FLAG_FAST;
-   if( !png_image_write_to_stdio(&image, stdout, 0, pixels, 0, NULL) )
+   /* Look up each output in cache.  If input is stdin, the first lookup
+      saves a copy of it, and subsequent lookups read from that copy.    */
+   for(i = 0; i < count; i++)
    {
-      fputs("Error writing output\n", stderr);
-      free(pixels);
-      return 1;
+      snprintf(options, sizeof(options), "%s%d %d %d %d %d %d",
+               specs[i].dither ? "-d " : "",
+               specs[i].w0, specs[i].h0, specs[i].w1, specs[i].h1,
+               specs[i].x, specs[i].y);
+      if( !OpenToolCache(caches + i, *argv, options,
+                         i == 0 ? input : caches[0].input, outputs[i]) )
+      {
+         while( --i >= 0 )
+            CloseToolCache(caches + i, 1);
+         return 1;
+      }
+      if( !caches[i].hit )
+      {
+         miss_specs[miss_count] = specs[i];
+         misses[miss_count++] = caches[i].output;
+      }
    }
 
-   free(pixels);
-   return 0;
+   /* Produce all outputs that were not found in cache. */
+   status = 0;
+   if( miss_count > 0 )
+      status = CropTable(caches[0].input, misses, miss_specs, miss_count);
+
+   /* Close in reverse order, since the first cache may own the copy of
+      stdin that the others read from.                                  */
+   for(i = count - 1; i >= 0; i--)
+      status = CloseToolCache(caches + i, status);
+   return status;
 }
@@ -0,0 +1,370 @@
+/* Find duplicate tiles in a tile table.
+
+   Usage:
+
+      ./dedup_tiles [-p] {tile_width} {tile_height} {input.png} \
+                    [{atlas.png} {remap.lua} [{lua_name}]]
+
+   Splits input into a grid of tiles, hashes each tile, and reports the
+   number of unique tiles to stderr, along with the number of empty (fully
+   transparent) tiles and the ratio of unique tiles to all tiles.
+
+   If output filenames are given, unique tiles are written to atlas.png in
+   the order they first appeared, using the same number of columns as the
+   input.  Trailing cells in the last row are left transparent.  remap.lua
+   gets a Lua table (named "tile_remap" unless {lua_name} is specified)
+   that maps each 1-based input tile index to its 1-based atlas index:
+
+      tile_remap =
+      {
+         1, 2, 2, 3, ...
+      }
+
+   With "-p", atlas is written in packed 2bit palette format, same as
+   dither.exe.  This is only lossless for dithered inputs.
+
+   Input is read one row of tiles at a time, so memory usage is
+   proportional to input width plus the size of the unique tiles.
+*/
+
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include"image_io.h"
+
+/* FNV-1a hash parameters (64bit). */
+#define FNV_OFFSET_BASIS  0xcbf29ce484222325ull
+#define FNV_PRIME         0x100000001b3ull
+
+/* Unique tiles collected so far. */
+typedef struct
+{
+   /* Tile size in bytes. */
+   size_t tile_bytes;
+
+   /* Pixels for all unique tiles, tile_bytes each. */
+   png_bytep pixels;
+   uint64_t *hashes;
+   int count;
+   int capacity;
+
+   /* Open addressing hash table of tile indices, -1 for unused slots.
+      Size is always a power of 2 and at least twice the tile count.   */
+   int *slots;
+   int slot_count;
+} TileSet;
+
+/* Copy a single tile from a band of rows to a contiguous buffer. */
+static void ExtractTile(png_const_bytep band, int band_width,
+                        int x, int tile_width, int tile_height,
+                        png_bytep tile)
+{
+   const size_t row_bytes = (size_t)tile_width * IMAGE_PIXEL_SIZE;
+   int y;
+
+   for(y = 0; y < tile_height; y++)
+   {
+      memcpy(tile + y * row_bytes,
+             band + ((size_t)y * band_width + x) * IMAGE_PIXEL_SIZE,
+             row_bytes);
+   }
+}
+
+/* Compute hash of tile pixels. */
+static uint64_t HashTile(png_const_bytep tile, size_t size)
+{
+   uint64_t hash = FNV_OFFSET_BASIS;
+   size_t i;
+
+   for(i = 0; i < size; i++)
+      hash = (hash ^ tile[i]) * FNV_PRIME;
+   return hash;
+}
+
+/* Check if all pixels in a tile are transparent. */
+static int IsEmptyTile(png_const_bytep tile, size_t size)
+{
+   size_t i;
+
+   for(i = 1; i < size; i += IMAGE_PIXEL_SIZE)
+   {
+      if( tile[i] != 0 )
+         return 0;
+   }
+   return 1;
+}
+
+/* Insert tile index into hash table, growing it as needed.  Returns 1 on
+   success.                                                              */
+static int InsertSlot(TileSet *set, int index)
+{
+   int *slots, i, k;
+
+   if( set->count * 2 >= set->slot_count )
+   {
+      k = set->slot_count == 0 ? 64 : set->slot_count * 2;
+      if( (slots = (int*)malloc(k * sizeof(int))) == NULL )
+         return 0;
+      memset(slots, 0xff, k * sizeof(int));
+      free(set->slots);
+      set->slots = slots;
+      set->slot_count = k;
+      for(i = 0; i < index; i++)
+         InsertSlot(set, i);
+   }
+
+   k = (int)(set->hashes[index] & (uint64_t)(set->slot_count - 1));
+   while( set->slots[k] >= 0 )
+      k = (k + 1) & (set->slot_count - 1);
+   set->slots[k] = index;
+   return 1;
+}
+
+/* Find tile in set, adding it if it's new.  Returns tile index, or -1 if
+   out of memory.                                                        */
+static int AddTile(TileSet *set, png_const_bytep tile)
+{
+   const uint64_t hash = HashTile(tile, set->tile_bytes);
+   png_bytep pixels;
+   uint64_t *hashes;
+   int k, i;
+
+   if( set->slot_count > 0 )
+   {
+      k = (int)(hash & (uint64_t)(set->slot_count - 1));
+      for(; (i = set->slots[k]) >= 0; k = (k + 1) & (set->slot_count - 1))
+      {
+         if( set->hashes[i] == hash &&
+             memcmp(set->pixels + i * set->tile_bytes, tile,
+                    set->tile_bytes) == 0 )
+         {
+            return i;
+         }
+      }
+   }
+
+   if( set->count == set->capacity )
+   {
+      k = set->capacity * 2 + 16;
+      pixels = (png_bytep)realloc(set->pixels, k * set->tile_bytes);
+      if( pixels == NULL )
+         return -1;
+      set->pixels = pixels;
+      hashes = (uint64_t*)realloc(set->hashes, k * sizeof(uint64_t));
+      if( hashes == NULL )
+         return -1;
+      set->hashes = hashes;
+      set->capacity = k;
+   }
+   i = set->count;
+   memcpy(set->pixels + i * set->tile_bytes, tile, set->tile_bytes);
+   set->hashes[i] = hash;
+   if( !InsertSlot(set, i) )
+      return -1;
+   set->count++;
+   return i;
+}
+
+/* Write unique tiles to atlas image.  Returns 1 on success. */
+static int WriteAtlas(const TileSet *set, const char *filename, int packed,
+                      int columns, int tile_width, int tile_height)
+{
+   const size_t tile_row_bytes = (size_t)tile_width * IMAGE_PIXEL_SIZE;
+   const int rows = (set->count + columns - 1) / columns;
+   ImageWriter writer;
+   png_bytep row;
+   int ty, tx, y, i, ok;
+
+   row = (png_bytep)malloc(columns * tile_row_bytes);
+   if( row == NULL )
+      return 0;
+   if( packed )
+   {
+      ok = OpenPackedImageWriter(&writer, filename,
+                                 columns * tile_width, rows * tile_height);
+   }
+   else
+   {
+      ok = OpenImageWriter(&writer, filename,
+                           columns * tile_width, rows * tile_height);
+   }
+   if( !ok )
+   {
+      free(row);
+      return 0;
+   }
+
+   for(ty = 0; ok && ty < rows; ty++)
+   {
+      for(y = 0; ok && y < tile_height; y++)
+      {
+         memset(row, 0, columns * tile_row_bytes);
+         for(tx = 0; tx < columns; tx++)
+         {
+            i = ty * columns + tx;
+            if( i >= set->count )
+               break;
+            memcpy(row + tx * tile_row_bytes,
+                   set->pixels + i * set->tile_bytes + y * tile_row_bytes,
+                   tile_row_bytes);
+         }
+         ok = WriteImageRow(&writer, row);
+      }
+   }
+   free(row);
+   return CloseImageWriter(&writer) && ok;
+}
+
+/* Write remap table.  Returns 1 on success. */
+static int WriteRemap(const int *remap, int count, const char *filename,
+                      const char *name)
+{
+   FILE *outfile;
+   int i, ok;
+
+   if( (outfile = fopen(filename, "wb")) == NULL )
+      return 0;
+   fprintf(outfile, "%s =\n{\n", name);
+   for(i = 0; i < count; i++)
+   {
+      fprintf(outfile, "%s%d%s",
+              i % 16 == 0 ? "\t" : " ",
+              remap[i] + 1,
+              i == count - 1 ? "\n" : i % 16 == 15 ? ",\n" : ",");
+   }
+   ok = fprintf(outfile, "}\n") > 0;
+   if( fclose(outfile) != 0 )
+      ok = 0;
+   if( !ok )
+      remove(filename);
+   return ok;
+}
+
+int main(int argc, char **argv)
+{
+   ImageReader reader;
+   TileSet set;
+   const char *input, *atlas = NULL, *remap_file = NULL;
+   const char *name = "tile_remap";
+   png_bytep band = NULL, tile = NULL;
+   int *remap = NULL;
+   int packed, arg, tile_width, tile_height, columns, rows;
+   int tx, ty, y, i, empty, status;
+
+   packed = argc > 1 && strcmp(argv[1], "-p") == 0;
+   arg = 1 + packed;
+   if( argc - arg != 3 && argc - arg != 5 && argc - arg != 6 )
+   {
+      return printf("%s [-p] {tile_width} {tile_height} {input.png} "
+                    "[{atlas.png} {remap.lua} [{lua_name}]]\n", *argv);
+   }
+   tile_width = atoi(argv[arg]);
+   tile_height = atoi(argv[arg + 1]);
+   input = argv[arg + 2];
+   if( argc - arg >= 5 )
+   {
+      atlas = argv[arg + 3];
+      remap_file = argv[arg + 4];
+      if( argc - arg == 6 )
+         name = argv[arg + 5];
+   }
+   if( tile_width < 1 || tile_height < 1 )
+   {
+      printf("Invalid tile size: %s %s\n", argv[arg], argv[arg + 1]);
+      return 1;
+   }
+
+   /* Open input. */
+   if( !OpenImageReader(&reader, input) )
+   {
+      printf("Error reading %s\n", input);
+      return 1;
+   }
+   if( reader.width % tile_width != 0 || reader.height % tile_height != 0 )
+   {
+      printf("Image dimension is not a multiple of (%d,%d): (%d,%d)\n",
+             tile_width, tile_height, reader.width, reader.height);
+      CloseImageReader(&reader);
+      return 1;
+   }
+   columns = reader.width / tile_width;
+   rows = reader.height / tile_height;
+
+   memset(&set, 0, sizeof(set));
+   set.tile_bytes = (size_t)tile_width * tile_height * IMAGE_PIXEL_SIZE;
+   band = (png_bytep)malloc(
+      (size_t)reader.width * tile_height * IMAGE_PIXEL_SIZE);
+   tile = (png_bytep)malloc(set.tile_bytes);
+   remap = (int*)malloc((size_t)columns * rows * sizeof(int));
+   if( band == NULL || tile == NULL || remap == NULL )
+   {
+      puts("Out of memory");
+      status = 1;
+      goto cleanup;
+   }
+
+   /* Collect unique tiles, one row of tiles at a time. */
+   status = 0;
+   empty = 0;
+   for(ty = 0; ty < rows && status == 0; ty++)
+   {
+      for(y = 0; y < tile_height; y++)
+      {
+         if( !ReadImageRow(&reader, band + (size_t)y * reader.width *
+                                           IMAGE_PIXEL_SIZE) )
+         {
+            printf("Error loading %s\n", input);
+            status = 1;
+            break;
+         }
+      }
+      for(tx = 0; tx < columns && status == 0; tx++)
+      {
+         ExtractTile(band, reader.width, tx * tile_width,
+                     tile_width, tile_height, tile);
+         empty += IsEmptyTile(tile, set.tile_bytes);
+         if( (i = AddTile(&set, tile)) < 0 )
+         {
+            puts("Out of memory");
+            status = 1;
+         }
+         remap[ty * columns + tx] = i;
+      }
+   }
+   if( status != 0 )
+      goto cleanup;
+
+   i = (set.count + columns - 1) / columns;
+   fprintf(stderr, "%s: %d tiles, %d unique (%d empty), ratio %.3f, "
+           "atlas %dx%d\n",
+           input, columns * rows, set.count, empty,
+           (double)set.count / (columns * rows),
+           columns * tile_width, i * tile_height);
+
+   /* Write outputs. */
+   if( atlas != NULL )
+   {
+      if( !WriteAtlas(&set, atlas, packed, columns, tile_width, tile_height) )
+      {
+         printf("Error writing %s\n", atlas);
+         status = 1;
+      }
+      else if( !WriteRemap(remap, columns * rows, remap_file, name) )
+      {
+         printf("Error writing %s\n", remap_file);
+         remove(atlas);
+         status = 1;
+      }
+   }
+
+cleanup:
+   CloseImageReader(&reader);
+   free(band);
+   free(tile);
+   free(remap);
+   free(set.pixels);
+   free(set.hashes);
+   free(set.slots);
+   return status;
+}
@@ -2,10 +2,35 @@
 
    Usage:
 
-      ./dither {input.png} {output.png}
+      ./dither [-p] {input.png} {output.png}
+      ./dither [-p] -m {manifest.txt}
 
    Use "-" for input or output to read/write from stdin/stdout.
 
+   With "-p", output is written as a packed 2bit palette PNG instead of
+   8bit gray plus 8bit alpha.  Pixel values are the same either way, but
+   packed output is much smaller and faster to write.
+
+   With "-m", jobs are read from a manifest file (or stdin if "-"), with
+   one job per line in this format:
+
+      {input.png} {width}x{height}+{x}+{y} {output.png}
+
+   Each job crops the rectangle from the input and dithers it, same as:
+
+      convert {input.png} +repage -crop {width}x{height}+{x}+{y} png:- |
+      ./dither - {output.png}
+
+   Each input is decoded only once no matter how many jobs refer to it,
+   and all outputs from the same input are written in parallel.  Empty
+   lines and lines starting with "#" are ignored.
+
+   If TOOL_CACHE_DIR is set, output is cached, keyed on input contents
+   (see tool_cache.h).  In manifest mode, each job is cached separately,
+   and an input is only decoded if at least one of its jobs missed the
+   cache.  This makes rerunning a manifest after an edit that didn't
+   change the input image nearly free.
+
    Given a grayscale (8bit) plus alpha (8bit) PNG, output a black and
    white (1bit) plus transparency (1bit) PNG, with ordered-dithering.
 
@@ -14,129 +39,483 @@
    to do so.
 */
 
-#include<png.h>
+#include<stdatomic.h>
 #include<stdio.h>
 #include<stdlib.h>
 #include<string.h>
 #include<unistd.h>
+#include"dither_kernels.h"
+#include"image_io.h"
+#include"tool_cache.h"
+#include"worker_pool.h"
 
 #ifdef _WIN32
    #include<fcntl.h>
    #include<io.h>
 #endif
 
-/* https://en.wikipedia.org/wiki/Ordered_dithering */
-#if 0
-   #define PATTERN_SIZE 4
-   static const int pattern[PATTERN_SIZE][PATTERN_SIZE] =
-   {
-      { 0,  8,  2, 10},
-      {12,  4, 14,  6},
-      { 3, 11,  1,  9},
-      {15,  7, 13,  5}
-   };
-#else
-   #define PATTERN_SIZE 8
-   static const int pattern[PATTERN_SIZE][PATTERN_SIZE] =
-   {
-      { 0, 32,  8, 40,  2, 34, 10, 42},
-      {48, 16, 56, 24, 50, 18, 58, 26},
-      {12, 44,  4, 36, 14, 46,  6, 38},
-      {60, 28, 52, 20, 62, 30, 54, 22},
-      { 3, 35, 11, 43,  1, 33,  9, 41},
-      {51, 19, 59, 27, 49, 17, 57, 25},
-      {15, 47,  7, 39, 13, 45,  5, 37},
-      {63, 31, 55, 23, 61, 29, 53, 21}
-   };
-#endif
+/* Maximum number of threads for manifest mode. */
+#define MAX_THREADS  64
+
+/* Number of input scanlines to buffer in manifest mode.  Jobs are run
+   in parallel on each block of scanlines.                             */
+#define BLOCK_ROWS   64
 
-static unsigned char Dither(int x, int y, int v)
+/* Maximum length of a single manifest line. */
+#define MAX_LINE     4096
+
+/* A single crop+dither job from the manifest. */
+typedef struct
 {
-   v += pattern[y % PATTERN_SIZE][x % PATTERN_SIZE] * 255 /
-        (PATTERN_SIZE * PATTERN_SIZE) - 127;
-   return v > 127 ? 255 : 0;
-}
+   char *input;
+   char *output;
+   int x, y, width, height;
 
-int main(int argc, char **argv)
+   /* Set to 1 if the job started successfully and has not failed yet. */
+   int ok;
+
+   /* Output state.  Output is written to cache.output, which is the
+      same as "output" if cache is disabled.                           */
+   ToolCache cache;
+   ImageWriter writer;
+   png_bytep row;
+} Job;
+
+/* Jobs that share the same input, plus the current block of scanlines. */
+typedef struct
 {
-   png_image image;
-   png_bytep pixels, p;
+   Job **jobs;
+   int job_count;
+   int image_width;
+   png_bytep block;
+   int block_y;
+   int block_height;
+
+   /* Index of next job to be processed for the current block. */
+   atomic_int next_job;
+} JobGroup;
+
+/* Dither a single image. */
+static int DitherImage(const char *input, const char *output, int packed)
+{
+   ImageReader reader;
+   ImageWriter writer;
+   png_bytep row;
    int x, y;
 
-   if( argc != 3 )
-      return printf("%s {input.png} {output.png}\n", *argv);
-   if( strcmp(argv[2], "-") == 0 && isatty(STDOUT_FILENO) )
+   if( strcmp(output, "-") == 0 && isatty(STDOUT_FILENO) )
    {
       fputs("Not writing output to stdout because it's a tty\n", stderr);
       return 1;
    }
-   #ifdef _WIN32
-      setmode(STDIN_FILENO, O_BINARY);
-      setmode(STDOUT_FILENO, O_BINARY);
-   #endif
 
-   /* Load input. */
-   memset(&image, 0, sizeof(image));
-   image.version = PNG_IMAGE_VERSION;
-   if( strcmp(argv[1], "-") == 0 )
+   /* Open input. */
+   if( !OpenImageReader(&reader, input) )
    {
-      if( !png_image_begin_read_from_stdio(&image, stdin) )
+      if( strcmp(input, "-") == 0 )
          return puts("Error reading from stdin");
+      return printf("Error reading %s\n", input);
    }
+   row = (png_bytep)malloc(reader.width * IMAGE_PIXEL_SIZE);
+   if( row == NULL )
+   {
+      CloseImageReader(&reader);
+      return puts("Out of memory");
+   }
+
+   /* Open output. */
+   if( packed )
+      x = OpenPackedImageWriter(&writer, output, reader.width, reader.height);
    else
+      x = OpenImageWriter(&writer, output, reader.width, reader.height);
+   if( !x )
    {
-      if( !png_image_begin_read_from_file(&image, argv[1]) )
-         return printf("Error reading %s\n", argv[1]);
+      if( strcmp(output, "-") == 0 )
+         fputs("Error writing to stdout\n", stderr);
+      else
+         printf("Error writing %s\n", output);
+      CloseImageReader(&reader);
+      free(row);
+      return 1;
    }
-   image.format = PNG_FORMAT_GA;
-   pixels = (png_bytep)malloc(PNG_IMAGE_SIZE(image));
-   if( pixels == NULL )
-      return puts("Out of memory");
-   if( !png_image_finish_read(&image, NULL, pixels, 0, NULL) )
+
+   /* Dither pixels one scanline at a time. */
+   for(y = 0; y < reader.height; y++)
    {
-      free(pixels);
-      return printf("Error loading %s\n", argv[1]);
+      if( !ReadImageRow(&reader, row) )
+         break;
+
+      /* Dither color and alpha independently, and set color part to
+         zero if alpha is zero.                                       */
+      OrderedDitherRow(row, 0, y, reader.width);
+
+      if( !WriteImageRow(&writer, row) )
+         break;
    }
 
-   /* Dither pixels. */
-   p = pixels;
-   for(y = 0; y < (int)image.height; y++)
+   /* Check for errors.  If we stopped early and the reader didn't return
+      the current row, it was a read error, otherwise it was a write error
+      that will be reported when closing the writer.                     */
+   x = 0;
+   if( y < reader.height && reader.current_row == y )
+   {
+      printf("Error loading %s\n", input);
+      x = 1;
+   }
+   CloseImageReader(&reader);
+   free(row);
+   if( !CloseImageWriter(&writer) && x == 0 )
    {
-      for(x = 0; x < (int)image.width; x++, p += 2)
+      if( strcmp(output, "-") == 0 )
+         fputs("Error writing to stdout\n", stderr);
+      else
+         printf("Error writing %s\n", output);
+      x = 1;
+   }
+   return x;
+}
+
+/* Parse manifest.  Returns 1 on success, in which case "jobs" will point
+   to an array of "job_count" jobs that should be freed by the caller.    */
+static int LoadManifest(const char *filename, Job **jobs, int *job_count)
+{
+   FILE *infile;
+   char line[MAX_LINE], input[MAX_LINE], output[MAX_LINE];
+   Job *j;
+   int line_number, capacity, status;
+
+   *jobs = NULL;
+   *job_count = 0;
+   capacity = 0;
+   if( strcmp(filename, "-") == 0 )
+   {
+      infile = stdin;
+   }
+   else
+   {
+      infile = fopen(filename, "r");
+      if( infile == NULL )
       {
-         /* Dither color and alpha independently. */
-         *p = Dither(x, y, (int)*p);
-         *(p + 1) = Dither(x, y, (int)*(p + 1));
+         printf("Error reading %s\n", filename);
+         return 0;
+      }
+   }
+
+   status = 1;
+   for(line_number = 1; fgets(line, MAX_LINE, infile) != NULL; line_number++)
+   {
+      if( strspn(line, " \t\r\n") == strlen(line) || line[0] == '#' )
+         continue;
 
-         /* Set color part to zero if alpha is zero. */
-         if( *(p + 1) == 0 )
-            *p = 0;
+      if( *job_count == capacity )
+      {
+         capacity = capacity * 2 + 16;
+         j = (Job*)realloc(*jobs, capacity * sizeof(Job));
+         if( j == NULL )
+         {
+            puts("Out of memory");
+            status = 0;
+            break;
+         }
+         *jobs = j;
+      }
+      j = *jobs + *job_count;
+      memset(j, 0, sizeof(Job));
+      if( sscanf(line, "%s %dx%d+%d+%d %s",
+                 input, &j->width, &j->height, &j->x, &j->y, output) != 6 ||
+          j->width < 1 || j->height < 1 || j->x < 0 || j->y < 0 ||
+          strcmp(input, "-") == 0 || strcmp(output, "-") == 0 )
+      {
+         printf("%s:%d: syntax error\n", filename, line_number);
+         status = 0;
+         break;
+      }
+      j->input = strdup(input);
+      j->output = strdup(output);
+      ++*job_count;
+      if( j->input == NULL || j->output == NULL )
+      {
+         puts("Out of memory");
+         status = 0;
+         break;
       }
    }
 
-   /* Write output.  Here we set the flags to optimize for encoding speed
-      rather than output size so that we can iterate faster.  This is fine
-      since the output of this tool are intermediate files that are used
-      only in the build process, and are not the final PNGs that will be
-      committed.                                                           */
-   image.flags |= PNG_IMAGE_FLAG_FAST;
-   x = 0;
-   if( strcmp(argv[2], "-") == 0 )
+   if( infile != stdin )
+      fclose(infile);
+   return status;
+}
+
+/* Process the current block of scanlines for all jobs in a group.  Jobs
+   are handed out dynamically, so worker index is not used.             */
+static void RunJobs(void *context, int worker)
+{
+   JobGroup *group = (JobGroup*)context;
+   Job *j;
+   int i, y, y0, y1;
+
+   (void)worker;
+   for(;;)
    {
-      if( !png_image_write_to_stdio(&image, stdout, 0, pixels, 0, NULL) )
+      i = atomic_fetch_add(&group->next_job, 1);
+      if( i >= group->job_count )
+         break;
+
+      j = group->jobs[i];
+      if( !j->ok )
+         continue;
+      y0 = j->y > group->block_y ? j->y : group->block_y;
+      y1 = j->y + j->height < group->block_y + group->block_height
+         ? j->y + j->height : group->block_y + group->block_height;
+      for(y = y0; y < y1; y++)
       {
-         fputs("Error writing to stdout\n", stderr);
-         x = 1;
+         memcpy(j->row,
+                group->block +
+                ((y - group->block_y) * group->image_width + j->x) * 2,
+                j->width * IMAGE_PIXEL_SIZE);
+
+         /* Dither pattern is keyed on output coordinates. */
+         OrderedDitherRow(j->row, 0, y - j->y, j->width);
+         if( !WriteImageRow(&j->writer, j->row) )
+         {
+            j->ok = 0;
+            break;
+         }
       }
    }
-   else
+}
+
+/* Run all jobs that share the same input as jobs[0].  Returns 0 if all
+   jobs were successful.                                                */
+static int RunJobGroup(Job **jobs, int job_count, int packed)
+{
+   ImageReader reader;
+   JobGroup group;
+   WorkerPool pool;
+   Job *j;
+   int i, row, status, thread_count;
+
+   /* Open input. */
+   if( !OpenImageReader(&reader, jobs[0]->input) )
    {
-      if( !png_image_write_to_file(&image, argv[2], 0, pixels, 0, NULL) )
+      printf("Error reading %s\n", jobs[0]->input);
+      return 1;
+   }
+   memset(&group, 0, sizeof(group));
+   group.jobs = jobs;
+   group.job_count = job_count;
+   group.image_width = reader.width;
+   group.block = (png_bytep)malloc(
+      (size_t)reader.width * BLOCK_ROWS * IMAGE_PIXEL_SIZE);
+   if( group.block == NULL )
+   {
+      CloseImageReader(&reader);
+      puts("Out of memory");
+      return 1;
+   }
+
+   /* Open outputs. */
+   status = 0;
+   for(i = 0; i < job_count; i++)
+   {
+      j = jobs[i];
+      if( j->x + j->width > reader.width || j->y + j->height > reader.height )
+      {
+         printf("Crop rectangle %dx%d+%d+%d is outside of %s (%d,%d)\n",
+                j->width, j->height, j->x, j->y, j->input,
+                reader.width, reader.height);
+         status = 1;
+         continue;
+      }
+      j->row = (png_bytep)malloc(j->width * IMAGE_PIXEL_SIZE);
+      if( j->row == NULL )
+      {
+         puts("Out of memory");
+         status = 1;
+         continue;
+      }
+      if( packed )
+         j->ok = OpenPackedImageWriter(&j->writer, j->cache.output,
+                                       j->width, j->height);
+      else
+         j->ok = OpenImageWriter(&j->writer, j->cache.output,
+                                 j->width, j->height);
+      if( !j->ok )
       {
-         printf("Error writing %s\n", argv[2]);
-         x = 1;
+         printf("Error writing %s\n", j->output);
+         status = 1;
       }
    }
-   free(pixels);
-   return x;
+   thread_count = job_count < MAX_THREADS ? job_count : MAX_THREADS;
+   StartWorkerPool(&pool, thread_count);
+
+   /* Decode input one block at a time, and run all jobs on each block. */
+   for(group.block_y = 0; group.block_y < reader.height;
+       group.block_y += group.block_height)
+   {
+      group.block_height = reader.height - group.block_y < BLOCK_ROWS
+                         ? reader.height - group.block_y : BLOCK_ROWS;
+      for(row = 0; row < group.block_height; row++)
+      {
+         if( !ReadImageRow(&reader,
+                           group.block +
+                           row * reader.width * IMAGE_PIXEL_SIZE) )
+         {
+            break;
+         }
+      }
+      if( row < group.block_height )
+      {
+         printf("Error loading %s\n", jobs[0]->input);
+         status = 1;
+         break;
+      }
+
+      atomic_init(&group.next_job, 0);
+      RunWorkerPool(&pool, RunJobs, &group);
+   }
+   StopWorkerPool(&pool);
+
+   /* Finish writing outputs.  If we stopped early because of read errors,
+      closing the writers will remove the incomplete outputs.  "ok" is
+      updated to reflect the final state of each job.                    */
+   row = group.block_y < reader.height;
+   CloseImageReader(&reader);
+   free(group.block);
+   for(i = 0; i < job_count; i++)
+   {
+      j = jobs[i];
+      if( row )
+         j->ok = 0;
+      if( j->row != NULL )
+      {
+         if( !CloseImageWriter(&j->writer) )
+         {
+            if( status == 0 )
+            {
+               printf("Error writing %s\n", j->output);
+               status = 1;
+            }
+            j->ok = 0;
+         }
+         free(j->row);
+         j->row = NULL;
+      }
+   }
+   return status;
+}
+
+/* Run all jobs in a manifest. */
+static int DitherManifest(const char *tool, const char *manifest, int packed)
+{
+   Job *jobs, **group;
+   char options[64];
+   int job_count, group_size, i, k, status;
+
+   if( !LoadManifest(manifest, &jobs, &job_count) )
+   {
+      status = 1;
+      job_count = jobs == NULL ? 0 : job_count;
+      goto cleanup;
+   }
+   group = (Job**)malloc((job_count + 1) * sizeof(Job*));
+   if( group == NULL )
+   {
+      puts("Out of memory");
+      status = 1;
+      goto cleanup;
+   }
+
+   /* Look up each job in cache.  Jobs that hit, and jobs that failed
+      the lookup, are marked as done by releasing their input names.  */
+   status = 0;
+   for(i = 0; i < job_count; i++)
+   {
+      snprintf(options, sizeof(options), "%s%dx%d+%d+%d",
+               packed ? "-p " : "",
+               jobs[i].width, jobs[i].height, jobs[i].x, jobs[i].y);
+      k = OpenToolCache(&jobs[i].cache, tool, options,
+                        jobs[i].input, jobs[i].output);
+      if( !k )
+         status = 1;
+      if( !k || jobs[i].cache.hit )
+      {
+         free(jobs[i].input);
+         jobs[i].input = NULL;
+      }
+   }
+
+   /* Group jobs by input, in the order each input first appeared. */
+   for(i = 0; i < job_count; i++)
+   {
+      if( jobs[i].input == NULL )
+         continue;
+      group_size = 0;
+      for(k = i; k < job_count; k++)
+      {
+         if( jobs[k].input != NULL &&
+             strcmp(jobs[i].input, jobs[k].input) == 0 )
+         {
+            group[group_size++] = jobs + k;
+         }
+      }
+      status |= RunJobGroup(group, group_size, packed);
+
+      /* Mark jobs as done by releasing their input names. */
+      for(k = 0; k < group_size; k++)
+      {
+         free(group[k]->input);
+         group[k]->input = NULL;
+      }
+   }
+   free(group);
+
+   /* Insert new outputs into cache, and copy them to final outputs. */
+   for(i = 0; i < job_count; i++)
+   {
+      k = jobs[i].cache.hit ? 0 : !jobs[i].ok;
+      status |= CloseToolCache(&jobs[i].cache, k);
+   }
+
+cleanup:
+   for(i = 0; i < job_count; i++)
+   {
+      free(jobs[i].input);
+      free(jobs[i].output);
+   }
+   free(jobs);
+   return status;
+}
+
+int main(int argc, char **argv)
+{
+   ToolCache cache;
+   int packed, status;
+
+   packed = argc > 1 && strcmp(argv[1], "-p") == 0;
+   if( argc != 3 + packed )
+   {
+      printf("%s [-p] {input.png} {output.png}\n"
+             "%s [-p] -m {manifest.txt}\n",
+             *argv, *argv);
+      return 1;
+   }
+
+   #ifdef _WIN32
+      setmode(STDIN_FILENO, O_BINARY);
+      setmode(STDOUT_FILENO, O_BINARY);
+   #endif
+
+   if( strcmp(argv[1 + packed], "-m") == 0 )
+      return DitherManifest(*argv, argv[2 + packed], packed);
+
+   if( !OpenToolCache(&cache, *argv, packed ? "-p" : "",
+                      argv[1 + packed], argv[2 + packed]) )
+   {
+      return 1;
+   }
+   status = 0;
+   if( !cache.hit )
+      status = DitherImage(cache.input, cache.output, packed);
+   return CloseToolCache(&cache, status);
 }
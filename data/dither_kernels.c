@@ -0,0 +1,128 @@
+/* Dithering kernels.  See dither_kernels.h for details. */
+
+#include"dither_kernels.h"
+
+#if defined(__AVX2__)
+   #include<immintrin.h>
+#elif defined(__SSE2__)
+   #include<emmintrin.h>
+#elif defined(__ARM_NEON)
+   #include<arm_neon.h>
+#endif
+
+/* https://en.wikipedia.org/wiki/Ordered_dithering
+
+   The original expression for each channel was:
+
+      v + pattern[y % 8][x % 8] * 255 / 64 - 127 > 127 ? 255 : 0
+
+   which is equivalent to comparing v against a per-pixel threshold:
+
+      v > 254 - pattern[y % 8][x % 8] * 255 / 64
+
+   Thresholds range from 3 to 254, so they always fit in unsigned bytes.
+
+   Each row of the threshold table contains the 8 thresholds for one row
+   of the pattern, with each entry duplicated for gray and alpha, and the
+   whole sequence repeated 3 times.  This allows a 32 byte load at any of
+   the 8 pattern phases to pick up the thresholds for 16 interleaved
+   pixels starting at that phase.                                        */
+#define PATTERN_SIZE 8
+#define T(p)   (254 - (p) * 255 / (PATTERN_SIZE * PATTERN_SIZE))
+#define P8(a, b, c, d, e, f, g, h)  \
+   T(a), T(a), T(b), T(b), T(c), T(c), T(d), T(d),  \
+   T(e), T(e), T(f), T(f), T(g), T(g), T(h), T(h)
+#define ROW(a, b, c, d, e, f, g, h)  \
+   { P8(a, b, c, d, e, f, g, h),     \
+     P8(a, b, c, d, e, f, g, h),     \
+     P8(a, b, c, d, e, f, g, h) }
+static const uint8_t threshold[PATTERN_SIZE][PATTERN_SIZE * 2 * 3] =
+{
+   ROW( 0, 32,  8, 40,  2, 34, 10, 42),
+   ROW(48, 16, 56, 24, 50, 18, 58, 26),
+   ROW(12, 44,  4, 36, 14, 46,  6, 38),
+   ROW(60, 28, 52, 20, 62, 30, 54, 22),
+   ROW( 3, 35, 11, 43,  1, 33,  9, 41),
+   ROW(51, 19, 59, 27, 49, 17, 57, 25),
+   ROW(15, 47,  7, 39, 13, 45,  5, 37),
+   ROW(63, 31, 55, 23, 61, 29, 53, 21)
+};
+#undef ROW
+#undef P8
+#undef T
+
+void OrderedDitherRow(uint8_t *row, int x, int y, int width)
+{
+   const uint8_t *t =
+      threshold[y & (PATTERN_SIZE - 1)] + (x & (PATTERN_SIZE - 1)) * 2;
+   int i = 0;
+
+   /* Vectorized part.  Because the pattern period is 8 pixels and each
+      vector covers a multiple of 8 pixels, the threshold vector is the
+      same for every iteration within a row.
+
+      After comparing, each 16bit lane holds gray result in the low byte
+      and alpha result in the high byte (both 0x00 or 0xff).  Shifting
+      the lane right by 8 and OR-ing 0xff00 produces a mask that keeps
+      alpha and clears gray wherever alpha is zero.                    */
+   #if defined(__AVX2__)
+   {
+      const __m256i tv = _mm256_loadu_si256((const __m256i*)t);
+      const __m256i ones = _mm256_set1_epi8(-1);
+      const __m256i alpha_bits = _mm256_set1_epi16((short)0xff00);
+      __m256i v;
+
+      for(; i + 16 <= width; i += 16)
+      {
+         v = _mm256_loadu_si256((const __m256i*)(row + i * 2));
+         v = _mm256_xor_si256(
+                _mm256_cmpeq_epi8(_mm256_subs_epu8(v, tv),
+                                  _mm256_setzero_si256()),
+                ones);
+         v = _mm256_and_si256(
+                v, _mm256_or_si256(_mm256_srli_epi16(v, 8), alpha_bits));
+         _mm256_storeu_si256((__m256i*)(row + i * 2), v);
+      }
+   }
+   #elif defined(__SSE2__)
+   {
+      const __m128i tv = _mm_loadu_si128((const __m128i*)t);
+      const __m128i ones = _mm_set1_epi8(-1);
+      const __m128i alpha_bits = _mm_set1_epi16((short)0xff00);
+      __m128i v;
+
+      for(; i + 8 <= width; i += 8)
+      {
+         v = _mm_loadu_si128((const __m128i*)(row + i * 2));
+         v = _mm_xor_si128(
+                _mm_cmpeq_epi8(_mm_subs_epu8(v, tv), _mm_setzero_si128()),
+                ones);
+         v = _mm_and_si128(v, _mm_or_si128(_mm_srli_epi16(v, 8), alpha_bits));
+         _mm_storeu_si128((__m128i*)(row + i * 2), v);
+      }
+   }
+   #elif defined(__ARM_NEON)
+   {
+      const uint8x16_t tv = vld1q_u8(t);
+      const uint16x8_t alpha_bits = vdupq_n_u16(0xff00);
+      uint16x8_t v;
+
+      for(; i + 8 <= width; i += 8)
+      {
+         v = vreinterpretq_u16_u8(vcgtq_u8(vld1q_u8(row + i * 2), tv));
+         v = vandq_u16(v, vorrq_u16(vshrq_n_u16(v, 8), alpha_bits));
+         vst1q_u8(row + i * 2, vreinterpretq_u8_u16(v));
+      }
+   }
+   #endif
+
+   /* Scalar part, for remaining pixels or if SIMD is not available. */
+   for(; i < width; i++)
+   {
+      const int j = (i & (PATTERN_SIZE - 1)) * 2;
+      uint8_t *p = row + i * 2;
+
+      p[1] = p[1] > t[j + 1] ? 255 : 0;
+      p[0] = p[1] != 0 && p[0] > t[j] ? 255 : 0;
+   }
+}
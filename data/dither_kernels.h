@@ -0,0 +1,20 @@
+/* Dithering kernels shared by data tools.
+
+   All kernels operate on rows of 8bit gray plus 8bit alpha pixels (GA8),
+   with the two channels dithered independently, and with color set to
+   zero wherever alpha is zero.
+*/
+
+#ifndef DITHER_KERNELS_H_
+#define DITHER_KERNELS_H_
+
+#include<stdint.h>
+
+/* Apply ordered dithering to "width" pixels starting at "row", where the
+   first pixel is at (x, y) in image coordinates.  The dither pattern is
+   keyed on image coordinates, so dithering a cropped region with the
+   original offsets produces the same pixels as dithering the whole image
+   and cropping afterwards.                                               */
+void OrderedDitherRow(uint8_t *row, int x, int y, int width);
+
+#endif
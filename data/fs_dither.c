@@ -2,152 +2,388 @@
 
    Usage:
 
-      ./fs_dither {input.png} {output.png}
+      ./fs_dither [-p] [-j {threads}] {input.png} {output.png}
 
    Use "-" for input or output to read/write from stdin/stdout.
 
+   With "-p", output is written as a packed 2bit palette PNG instead of
+   8bit gray plus 8bit alpha.  Pixel values are the same either way, but
+   packed output is much smaller and faster to write.
+
+   With "-j", dithering is done using the specified number of threads.
+   Two threads will dither color and alpha channels concurrently, and
+   additional threads will dither multiple scanlines of the same channel
+   concurrently, with each scanline trailing the one above it by a few
+   pixels.  Output is identical regardless of thread count.
+
+   If TOOL_CACHE_DIR is set, output is cached, keyed on input contents
+   (see tool_cache.h).
+
    Given a grayscale (8bit) plus alpha (8bit) PNG, output a black and
    white (1bit) plus transparency (1bit) PNG, with Floyd-Steinberg dithering.
 */
 
-#include<png.h>
+#include<sched.h>
+#include<stdatomic.h>
 #include<stdio.h>
 #include<stdlib.h>
 #include<string.h>
 #include<unistd.h>
+#include"image_io.h"
+#include"tool_cache.h"
+#include"worker_pool.h"
 
 #ifdef _WIN32
    #include<fcntl.h>
    #include<io.h>
 #endif
 
-/* Dither a single channel. */
-static void DitherChannel(int *row_error[2],
-                          int width,
-                          int height,
-                          png_bytep pixels)
+/* Maximum number of threads for "-j". */
+#define MAX_THREADS  MAX_POOL_THREADS
+
+/* Number of scanlines to buffer for each round of multithreaded dithering.
+   Memory usage is proportional to this times image width.                 */
+#define BLOCK_ROWS   128
+
+/* Number of pixels to dither between progress updates.  A scanline will
+   trail the scanline above it by about this many pixels.                */
+#define SPAN_SIZE    32
+
+/* Error buffers for one channel.
+
+   Error for scanline y is held in buffer[y % buffer_count], and error for
+   scanline y+1 is held in the next buffer.  Each buffer is offset by one
+   pixel so that we don't need to check the left edge.
+
+   Up to thread_count scanlines of each channel can be in progress at the
+   same time, and each one needs two buffers, so we keep thread_count+1
+   buffers.  When scanline y starts, scanline y+1-buffer_count is always
+   complete, so we can clear its buffer and reuse it for scanline y+1.    */
+typedef struct
+{
+   int **buffer;
+   int buffer_count;
+
+   /* Number of pixels completed for each row in the current block. */
+   atomic_int *progress;
+} ChannelState;
+
+/* State shared by all threads. */
+typedef struct
+{
+   int width;
+   ChannelState channel[2];
+
+   /* Current block of scanlines, with index of the first scanline. */
+   png_bytep block;
+   int block_y;
+   int block_height;
+
+   /* Index of next scanline to be dithered.  Even numbers are color
+      channel, odd numbers are alpha channel.  Scanlines are always handed
+      out in order, which guarantees that the scanline above the current
+      one is either complete or being worked on by some other thread.    */
+   atomic_int next_task;
+} DitherState;
+
+/* Dither a span of pixels in a single scanline of a single channel.
+
+   The current scanline's accumulated error is read from row_error, and
+   propagated to both row_error and next_error.                         */
+static void DitherSpan(int *row_error, int *next_error, int x0, int x1,
+                       png_bytep p)
 {
-   int y0 = 0, y1 = 1, x, y, i, o, e;
-   png_bytep p = pixels;
+   int x, i, o, e;
 
-   memset(row_error[0], 0, (width + 2) * sizeof(int));
-   for(y = 0; y < height; y++)
+   for(x = x0, p += x0 * 2; x < x1; x++, p += 2)
    {
-      /* Reset error for next scanline. */
-      memset(row_error[y1], 0, (width + 2) * sizeof(int));
+      /* i = intended grayscale level. */
+      i = *p + row_error[x + 1] / 16;
+
+      /* o = output grayscale level. */
+      o = i > 127 ? 255 : 0;
+      *p = o;
+
+      /* Propagate error. */
+      e = i - o;
+      row_error[x + 2] += e * 7;
+      next_error[x    ] += e * 3;
+      next_error[x + 1] += e * 5;
+      next_error[x + 2] += e;
+   }
+}
+
+/* Wait until at least "target" pixels are completed for a scanline. */
+static void WaitForProgress(atomic_int *progress, int target)
+{
+   while( atomic_load_explicit(progress, memory_order_acquire) < target )
+      sched_yield();
+}
+
+/* Dither scanlines from the current block until there are no more.
 
-      /* Dither a single scanline. */
-      for(x = 0; x < width; x++, p += 2)
+   Error propagated to pixel x of the next scanline comes from pixels
+   x-1, x, and x+1 of the current scanline, and pixel x of the next
+   scanline also adds to the error for pixel x+1.  Thus pixel x can be
+   processed once pixels up to x+2 of the previous scanline are done.
+   Integer additions are commutative, so the result is exactly the same
+   as dithering one scanline at a time.
+
+   Scanlines are handed out dynamically, so worker index is not used.   */
+static void DitherBlock(void *context, int worker)
+{
+   DitherState *state = (DitherState*)context;
+   ChannelState *channel;
+   int task, row, y, x0, x1;
+   int *row_error, *next_error;
+   png_bytep p;
+
+   (void)worker;
+   for(;;)
+   {
+      task = atomic_fetch_add(&state->next_task, 1);
+      row = task / 2;
+      if( row >= state->block_height )
+         break;
+
+      channel = &state->channel[task & 1];
+      y = state->block_y + row;
+      row_error = channel->buffer[y % channel->buffer_count];
+      next_error = channel->buffer[(y + 1) % channel->buffer_count];
+      memset(next_error, 0, (state->width + 2) * sizeof(int));
+
+      p = state->block + row * state->width * 2 + (task & 1);
+      for(x0 = 0; x0 < state->width; x0 = x1)
       {
-         /* i = intended grayscale level. */
-         i = *p + row_error[y0][x + 1] / 16;
-
-         /* o = output grayscale level. */
-         o = i > 127 ? 255 : 0;
-         *p = o;
-
-         /* Propagate error. */
-         e = i - o;
-         row_error[y0][x + 2] += e * 7;
-         row_error[y1][x    ] += e * 3;
-         row_error[y1][x + 1] += e * 5;
-         row_error[y1][x + 2] += e;
+         x1 = x0 + SPAN_SIZE < state->width ? x0 + SPAN_SIZE : state->width;
+
+         /* Rows at the start of each block don't need to wait since the
+            previous block is always complete.                          */
+         if( row > 0 )
+         {
+            WaitForProgress(&channel->progress[row - 1],
+                            x1 + 2 < state->width ? x1 + 2 : state->width);
+         }
+         DitherSpan(row_error, next_error, x0, x1, p);
+         atomic_store_explicit(&channel->progress[row], x1,
+                               memory_order_release);
       }
+   }
+}
 
-      y0 ^= 1;
-      y1 ^= 1;
+/* Dither all scanlines in the current block. */
+static void DitherAllRows(DitherState *state, WorkerPool *pool)
+{
+   int i;
+
+   for(i = 0; i < state->block_height; i++)
+   {
+      atomic_init(&state->channel[0].progress[i], 0);
+      atomic_init(&state->channel[1].progress[i], 0);
    }
+   atomic_init(&state->next_task, 0);
+   RunWorkerPool(pool, DitherBlock, state);
 }
 
-int main(int argc, char **argv)
+/* Allocate error buffers for one channel.  Returns 1 on success. */
+static int InitChannel(ChannelState *channel, int width, int thread_count)
 {
-   png_image image;
-   png_bytep pixels, p;
-   int x, y;
-   int *row_error[2];
+   int i;
+
+   channel->buffer_count = thread_count + 1;
+   channel->buffer = (int**)calloc(channel->buffer_count, sizeof(int*));
+   channel->progress = (atomic_int*)calloc(BLOCK_ROWS, sizeof(atomic_int));
+   if( channel->buffer == NULL || channel->progress == NULL )
+      return 0;
+   for(i = 0; i < channel->buffer_count; i++)
+   {
+      channel->buffer[i] = (int*)calloc(width + 2, sizeof(int));
+      if( channel->buffer[i] == NULL )
+         return 0;
+   }
+   return 1;
+}
 
-   if( argc != 3 )
-      return printf("%s {input.png} {output.png}\n", *argv);
+/* Release error buffers for one channel. */
+static void FreeChannel(ChannelState *channel)
+{
+   int i;
 
-   if( strcmp(argv[2], "-") == 0 && isatty(STDOUT_FILENO) )
+   if( channel->buffer != NULL )
    {
-      fputs("Not writing output to stdout because it's a tty\n", stderr);
-      return 1;
+      for(i = 0; i < channel->buffer_count; i++)
+         free(channel->buffer[i]);
    }
-   #ifdef _WIN32
-      setmode(STDIN_FILENO, O_BINARY);
-      setmode(STDOUT_FILENO, O_BINARY);
-   #endif
+   free(channel->buffer);
+   free(channel->progress);
+}
+
+/* Dither a single image.  Returns zero on success. */
+static int DitherImage(const char *input, const char *output,
+                       int packed, int thread_count)
+{
+   ImageReader reader;
+   ImageWriter writer;
+   DitherState state;
+   WorkerPool pool;
+   png_bytep row_pixels, p;
+   int x, y, row;
 
-   /* Load input. */
-   memset(&image, 0, sizeof(image));
-   image.version = PNG_IMAGE_VERSION;
-   if( strcmp(argv[1], "-") == 0 )
+   /* Open input.  Since Floyd-Steinberg only carries errors to the next
+      scanline, we only need to keep a few rows of errors per channel, and
+      we can dither while streaming the input.                            */
+   if( !OpenImageReader(&reader, input) )
    {
-      if( !png_image_begin_read_from_stdio(&image, stdin) )
+      if( strcmp(input, "-") == 0 )
          return puts("Error reading from stdin");
+      return printf("Error reading %s\n", input);
    }
-   else
+   memset(&state, 0, sizeof(state));
+   state.width = reader.width;
+   state.block = (png_bytep)malloc(
+      (size_t)reader.width * BLOCK_ROWS * IMAGE_PIXEL_SIZE);
+   if( state.block == NULL ||
+       !InitChannel(&state.channel[0], reader.width, thread_count) ||
+       !InitChannel(&state.channel[1], reader.width, thread_count) )
    {
-      if( !png_image_begin_read_from_file(&image, argv[1]) )
-         return printf("Error reading %s\n", argv[1]);
-   }
-
-   row_error[0] = (int*)malloc((image.width + 2) * sizeof(int));
-   row_error[1] = (int*)malloc((image.width + 2) * sizeof(int));
-   if( row_error[0] == NULL || row_error[1] == NULL )
+      CloseImageReader(&reader);
+      free(state.block);
+      FreeChannel(&state.channel[0]);
+      FreeChannel(&state.channel[1]);
       return puts("Out of memory");
+   }
 
-   image.format = PNG_FORMAT_GA;
-   pixels = (png_bytep)malloc(PNG_IMAGE_SIZE(image));
-   if( pixels == NULL )
-      return puts("Out of memory");
-   if( !png_image_finish_read(&image, NULL, pixels, 0, NULL) )
+   /* Open output. */
+   if( packed )
+      x = OpenPackedImageWriter(&writer, output, reader.width, reader.height);
+   else
+      x = OpenImageWriter(&writer, output, reader.width, reader.height);
+   if( !x )
    {
-      free(pixels);
-      return printf("Error loading %s\n", argv[1]);
+      if( strcmp(output, "-") == 0 )
+         fputs("Error writing to stdout\n", stderr);
+      else
+         printf("Error writing %s\n", output);
+      CloseImageReader(&reader);
+      free(state.block);
+      FreeChannel(&state.channel[0]);
+      FreeChannel(&state.channel[1]);
+      return 1;
    }
 
-   /* Dither color and alpha channel independently. */
-   DitherChannel(row_error, (int)image.width, (int)image.height, pixels);
-   DitherChannel(row_error, (int)image.width, (int)image.height, pixels + 1);
-
-   /* Set color to zero if the corresponding alpha is zero. */
-   p = pixels;
-   for(y = 0; y < (int)image.height; y++)
+   /* Dither pixels one block of scanlines at a time. */
+   StartWorkerPool(&pool, thread_count);
+   for(y = 0; y < reader.height; y += state.block_height)
    {
-      for(x = 0; x < (int)image.width; x++, p += 2)
+      state.block_y = y;
+      state.block_height = reader.height - y < BLOCK_ROWS
+                         ? reader.height - y : BLOCK_ROWS;
+      for(row = 0; row < state.block_height; row++)
+      {
+         row_pixels = state.block + row * reader.width * IMAGE_PIXEL_SIZE;
+         if( !ReadImageRow(&reader, row_pixels) )
+            break;
+      }
+      if( row < state.block_height )
+         break;
+
+      /* Dither color and alpha channel independently. */
+      DitherAllRows(&state, &pool);
+
+      for(row = 0; row < state.block_height; row++)
       {
-         if( *(p + 1) == 0 )
-            *p = 0;
+         /* Set color to zero if the corresponding alpha is zero. */
+         row_pixels = state.block + row * reader.width * IMAGE_PIXEL_SIZE;
+         p = row_pixels;
+         for(x = 0; x < reader.width; x++, p += 2)
+         {
+            if( *(p + 1) == 0 )
+               *p = 0;
+         }
+
+         if( !WriteImageRow(&writer, row_pixels) )
+            break;
       }
+      if( row < state.block_height )
+         break;
    }
+   StopWorkerPool(&pool);
 
-   /* Write output.  Here we set the flags to optimize for encoding speed
-      rather than output size so that we can iterate faster.  This is fine
-      since the output of this tool are intermediate files that are used
-      only in the build process, and are not the final PNGs that will be
-      committed.                                                           */
-   image.flags |= PNG_IMAGE_FLAG_FAST;
+   /* Check for errors.  If we stopped early and the reader didn't return
+      all rows of the current block, it was a read error, otherwise it was
+      a write error that will be reported when closing the writer.        */
    x = 0;
-   if( strcmp(argv[2], "-") == 0 )
+   if( y < reader.height && reader.current_row < y + state.block_height )
    {
-      if( !png_image_write_to_stdio(&image, stdout, 0, pixels, 0, NULL) )
-      {
+      printf("Error loading %s\n", input);
+      x = 1;
+   }
+   CloseImageReader(&reader);
+   free(state.block);
+   FreeChannel(&state.channel[0]);
+   FreeChannel(&state.channel[1]);
+   if( !CloseImageWriter(&writer) && x == 0 )
+   {
+      if( strcmp(output, "-") == 0 )
          fputs("Error writing to stdout\n", stderr);
-         x = 1;
-      }
+      else
+         printf("Error writing %s\n", output);
+      x = 1;
    }
-   else
+   return x;
+}
+
+int main(int argc, char **argv)
+{
+   ToolCache cache;
+   const char *input, *output;
+   int packed, thread_count, arg, status;
+
+   packed = 0;
+   thread_count = 1;
+   for(arg = 1; arg + 2 < argc; arg++)
    {
-      if( !png_image_write_to_file(&image, argv[2], 0, pixels, 0, NULL) )
+      if( strcmp(argv[arg], "-p") == 0 )
+      {
+         packed = 1;
+      }
+      else if( strcmp(argv[arg], "-j") == 0 && arg + 3 < argc )
+      {
+         thread_count = atoi(argv[++arg]);
+         if( thread_count < 1 || thread_count > MAX_THREADS )
+         {
+            printf("Invalid thread count: %s\n", argv[arg]);
+            return 1;
+         }
+      }
+      else
       {
-         printf("Error writing %s\n", argv[2]);
-         x = 1;
+         break;
       }
    }
-   free(row_error[0]);
-   free(row_error[1]);
-   free(pixels);
-   return x;
+   if( arg + 2 != argc )
+   {
+      return printf("%s [-p] [-j {threads}] {input.png} {output.png}\n",
+                    *argv);
+   }
+   input = argv[arg];
+   output = argv[arg + 1];
+
+   if( strcmp(output, "-") == 0 && isatty(STDOUT_FILENO) )
+   {
+      fputs("Not writing output to stdout because it's a tty\n", stderr);
+      return 1;
+   }
+   #ifdef _WIN32
+      setmode(STDIN_FILENO, O_BINARY);
+      setmode(STDOUT_FILENO, O_BINARY);
+   #endif
+
+   /* Only "-p" affects output, thread count doesn't. */
+   if( !OpenToolCache(&cache, *argv, packed ? "-p" : "", input, output) )
+      return 1;
+   status = 0;
+   if( !cache.hit )
+      status = DitherImage(cache.input, cache.output, packed, thread_count);
+   return CloseToolCache(&cache, status);
 }
@@ -0,0 +1,559 @@
+/* Generate a bank of pregenerated maps for the game.
+
+   Usage:
+
+      ./generate_map_bank [--count {n}] [--seed {seed}] {output.bin}
+
+   Generates {n} maps (default 16) using the same algorithm as
+   init_walls_and_floors in main.lua, and writes them to a single binary
+   file.  If seed is not specified, current time is used.  Each map gets
+   its own random stream derived from the seed, so a bank generated with
+   a larger count starts with the same maps as a smaller one.
+
+   Output format, all integers are little endian:
+
+      Header (16 bytes):
+         char[4]  magic = "RPSM"
+         uint16   format version = 1
+         uint16   map count
+         uint16   collision table width
+         uint16   collision table height
+         uint16   floor table width
+         uint16   floor table height
+
+      Followed by map records, each with the same size, so that map {i}
+      begins at offset 16 + i * record_size:
+
+         Wall bits: one row per collision table row, ceil(width/8) bytes
+            per row.  Bit (x & 7) of byte (x >> 3) is set for walls.
+            Borders outside of the game area are included.
+         Floor tiles: floor table width * height bytes, each holding
+            floor_tiles value minus 1.  Edge bits around the special tile
+            are already applied, and the special tile itself is stored
+            as zero.
+         uint8    special_x
+         uint8    special_y
+         uint8    special tile variation (1..16)
+         uint8    reserved, always zero
+
+   This replaces everything before the "game_in_progress" wait except
+   for the parts that depend on the object shuffle or on per-game
+   randomness.  A loader still needs to decode the wall bits into
+   collision_table, open up spawn holes at the shuffled world_positions,
+   compute wall_tiles (adjacency plus rand(0,7) variations), and pick
+   floor_shift_x/floor_shift_y.
+
+   Statistics are written to stderr: bank size, time spent generating
+   each map procedurally, and time spent loading each map from the bank.
+   Both timings include the load-time steps listed above, and every
+   loaded map is checked against its generated counterpart.
+*/
+
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<time.h>
+#include<unistd.h>
+
+#ifdef _WIN32
+   #include<fcntl.h>
+   #include<io.h>
+#endif
+
+/* Game constants, same as main.lua. */
+#define WORLD_SIZE           1280
+#define HORIZONTAL_PADDING   ((400 / 2) + 32)
+#define VERTICAL_PADDING     ((240 / 2) + 32)
+#define OBJECT_COUNT         (99 * 3 + 16)
+
+#define COLLISION_TABLE_WIDTH   ((WORLD_SIZE + HORIZONTAL_PADDING * 2) >> 3)
+#define COLLISION_TABLE_HEIGHT  ((WORLD_SIZE + VERTICAL_PADDING * 2) >> 3)
+#define FLOOR_TABLE_WIDTH       ((COLLISION_TABLE_WIDTH >> 3) + 2)
+#define FLOOR_TABLE_HEIGHT      ((COLLISION_TABLE_HEIGHT >> 3) + 2)
+
+#define GAME_AREA_MIN_X  (HORIZONTAL_PADDING >> 3)
+#define GAME_AREA_MAX_X  ((HORIZONTAL_PADDING + WORLD_SIZE) >> 3)
+#define GAME_AREA_MIN_Y  (VERTICAL_PADDING >> 3)
+#define GAME_AREA_MAX_Y  ((VERTICAL_PADDING + WORLD_SIZE) >> 3)
+
+#define MAX_WORLD_POSITIONS  ((WORLD_SIZE / 64) * (WORLD_SIZE / 64))
+
+/* Cell index for 1-based coordinates, same as main.lua tables. */
+#define GRID_INDEX(x, y)  (((y) - 1) * COLLISION_TABLE_WIDTH + (x) - 1)
+#define GRID_SIZE         (COLLISION_TABLE_WIDTH * COLLISION_TABLE_HEIGHT)
+#define FLOOR_SIZE        (FLOOR_TABLE_WIDTH * FLOOR_TABLE_HEIGHT)
+
+/* Bank layout. */
+#define BANK_MAGIC          "RPSM"
+#define BANK_VERSION        1
+#define BANK_HEADER_SIZE    16
+#define WALL_ROW_BYTES      ((COLLISION_TABLE_WIDTH + 7) / 8)
+#define WALL_BITS_SIZE      (WALL_ROW_BYTES * COLLISION_TABLE_HEIGHT)
+#define MAP_RECORD_SIZE     (WALL_BITS_SIZE + FLOOR_SIZE + 4)
+
+/* Limit on map count, to keep the bank a reasonable size for the pdx. */
+#define DEFAULT_MAP_COUNT   16
+#define MAX_MAP_COUNT       1024
+
+/* Map data that is stored in the bank. */
+typedef struct
+{
+   /* Wall cells, 1 for walls and 0 for open space. */
+   uint8_t walls[GRID_SIZE];
+
+   /* floor_tiles values minus 1, with special tile set to zero. */
+   uint8_t floor[FLOOR_SIZE];
+
+   int special_x, special_y, special_variation;
+} MapData;
+
+/* Map data after load-time steps, same layout as main.lua tables. */
+typedef struct
+{
+   int8_t collision_table[GRID_SIZE];
+   uint8_t wall_tiles[GRID_SIZE];
+   uint16_t floor_tiles[FLOOR_SIZE];
+   int floor_shift_x, floor_shift_y;
+} LoadedMap;
+
+/* Initial object positions in collision_table coordinates, in the same
+   order as world_positions before the shuffle.                         */
+static int world_positions[MAX_WORLD_POSITIONS][2];
+
+/* ....................................................................... */
+
+/* Random number generator (splitmix64).  Maps don't need to match any
+   particular game seed, so we don't bother reproducing Lua's generator. */
+static uint64_t NextRandom(uint64_t *state)
+{
+   uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+
+   z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+   z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+   return z ^ (z >> 31);
+}
+
+/* Return random integer in the range of [low, up], same as
+   math.random(low, up).                                    */
+static int RandomRange(uint64_t *state, int low, int up)
+{
+   const uint64_t n = (uint64_t)(up - low) + 1;
+   return low + (int)(((NextRandom(state) >> 32) * n) >> 32);
+}
+
+/* Return random integer in the range of [1, up], same as math.random(up). */
+static int Random1(uint64_t *state, int up)
+{
+   return RandomRange(state, 1, up);
+}
+
+/* ....................................................................... */
+
+/* Initialize world_positions, same as init_world_positions. */
+static void InitWorldPositions()
+{
+   int i = 0, x, y;
+
+   for(y = GAME_AREA_MIN_Y + 3; y <= GAME_AREA_MAX_Y - 3; y += 16)
+   {
+      for(x = GAME_AREA_MIN_X + 3; x <= GAME_AREA_MAX_X - 3; x += 8)
+      {
+         world_positions[i][0] = x;
+         world_positions[i][1] = y;
+         i++;
+      }
+      for(x = GAME_AREA_MIN_X + 7; x <= GAME_AREA_MAX_X - 3; x += 8)
+      {
+         world_positions[i][0] = x;
+         world_positions[i][1] = y + 8;
+         i++;
+      }
+   }
+}
+
+/* Set edge bit on a floor tile, same as set_floor_edge_bit. */
+static void SetFloorEdgeBit(MapData *map, int index, int bitmask)
+{
+   map->floor[index - 1] |= bitmask;
+}
+
+/* Generate walls and floors, same as the first half of
+   init_walls_and_floors.                                */
+static void GenerateMap(uint64_t *state, MapData *map)
+{
+   uint8_t *target = map->walls;
+   int x, y, i, c, t, special_index;
+
+   /* Populate all cells with random values. */
+   for(i = 0; i < GRID_SIZE; i++)
+      target[i] = Random1(state, 101) < 45 ? 1 : 0;
+
+   /* Apply a few rounds of smoothing.  main.lua always uses the same
+      table as source and target (see InitWalls in simulate_game.c), so
+      each cell is updated in place.                                    */
+   for(i = 0; i < 4; i++)
+   {
+      for(y = 2; y <= COLLISION_TABLE_HEIGHT - 1; y++)
+      {
+         for(x = 2; x <= COLLISION_TABLE_WIDTH - 1; x++)
+         {
+            c = GRID_INDEX(x, y);
+            target[c] = (uint8_t)
+               ((target[c - COLLISION_TABLE_WIDTH - 1] +
+                 target[c - COLLISION_TABLE_WIDTH] +
+                 target[c - COLLISION_TABLE_WIDTH + 1] +
+                 target[c - 1] + target[c] + target[c + 1] +
+                 target[c + COLLISION_TABLE_WIDTH - 1] +
+                 target[c + COLLISION_TABLE_WIDTH] +
+                 target[c + COLLISION_TABLE_WIDTH + 1]) / 5);
+         }
+      }
+   }
+
+   /* Fill borders. */
+   for(y = 1; y <= COLLISION_TABLE_HEIGHT; y++)
+   {
+      for(x = 1; x <= COLLISION_TABLE_WIDTH; x++)
+      {
+         if( y < GAME_AREA_MIN_Y || y > GAME_AREA_MAX_Y ||
+             x < GAME_AREA_MIN_X || x > GAME_AREA_MAX_X )
+         {
+            target[GRID_INDEX(x, y)] = 1;
+         }
+      }
+   }
+
+   /* Floor tiles.  Values are stored minus 1 here, so tile bits are
+      used directly.                                                  */
+   for(x = 0; x < FLOOR_TABLE_WIDTH; x++)
+      map->floor[x] = (uint8_t)(Random1(state, 256) - 1);
+   for(y = 1; y < FLOOR_TABLE_HEIGHT; y++)
+   {
+      i = y * FLOOR_TABLE_WIDTH;
+      t = RandomRange(state, 0, 255);
+      map->floor[i] = (uint8_t)t;
+      for(x = 1; x < FLOOR_TABLE_WIDTH; x++)
+      {
+         t = ((t & 2) << 6) |
+             ((map->floor[i + x - FLOOR_TABLE_WIDTH] & 1) << 6) |
+             RandomRange(state, 0, 63);
+         map->floor[i + x] = (uint8_t)t;
+      }
+   }
+
+   /* Special floor tile.  special_index is a 1-based index into
+      floor_tiles, same as main.lua.                             */
+   map->special_x = Random1(state, WORLD_SIZE / 64 - 4) +
+                    (HORIZONTAL_PADDING / 64) + 2;
+   map->special_y = Random1(state, WORLD_SIZE / 64 - 4) +
+                    (VERTICAL_PADDING / 64) + 2;
+   map->special_variation = Random1(state, 16);
+   special_index = map->special_y * FLOOR_TABLE_WIDTH + map->special_x;
+   map->floor[special_index - 1] = 0;
+
+   SetFloorEdgeBit(map, special_index - FLOOR_TABLE_WIDTH, 0x01);
+   SetFloorEdgeBit(map, special_index - 1, 0x02);
+   SetFloorEdgeBit(map, special_index + 1, 0x80);
+   SetFloorEdgeBit(map, special_index + FLOOR_TABLE_WIDTH, 0x40);
+}
+
+/* Apply the steps that can't be stored in the bank: open spawn holes,
+   build wall tiles, expand floor tiles, and pick floor shifts.  This is
+   what a loader would still need to do after decoding a bank record.   */
+static void FinishMap(uint64_t *state, const MapData *map, LoadedMap *out)
+{
+   int8_t *target = out->collision_table;
+   int x, y, i, c, special_index;
+
+   for(i = 0; i < GRID_SIZE; i++)
+      target[i] = (int8_t)-map->walls[i];
+
+   /* Open up holes to ensure that objects have room to spawn.  Holes
+      depend on the object shuffle, which we don't model here, so we
+      just use the first OBJECT_COUNT positions.                        */
+   for(i = 0; i < OBJECT_COUNT; i++)
+   {
+      c = GRID_INDEX(world_positions[i][0], world_positions[i][1]);
+      target[c] = target[c + 1] = 0;
+      target[c + COLLISION_TABLE_WIDTH] =
+         target[c + COLLISION_TABLE_WIDTH + 1] = 0;
+   }
+
+   /* Wall tiles. */
+   memset(out->wall_tiles, 0x81, GRID_SIZE);
+   for(y = 2; y <= COLLISION_TABLE_HEIGHT - 1; y++)
+   {
+      for(x = 2; x <= COLLISION_TABLE_WIDTH - 1; x++)
+      {
+         c = GRID_INDEX(x, y);
+         if( target[c] != 0 )
+            continue;
+         out->wall_tiles[c] = (uint8_t)
+            ((target[c + 1] & 0x01) +
+             (target[c + COLLISION_TABLE_WIDTH] & 0x02) +
+             (target[c - 1] & 0x04) +
+             (target[c - COLLISION_TABLE_WIDTH] & 0x08) +
+             (RandomRange(state, 0, 7) << 4) +
+             1);
+      }
+   }
+
+   /* Floor tiles. */
+   for(i = 0; i < FLOOR_SIZE; i++)
+      out->floor_tiles[i] = (uint16_t)(map->floor[i] + 1);
+   special_index = map->special_y * FLOOR_TABLE_WIDTH + map->special_x;
+   out->floor_tiles[special_index - 1] =
+      (uint16_t)(256 + map->special_variation);
+
+   out->floor_shift_x = Random1(state, 64);
+   out->floor_shift_y = Random1(state, 64);
+}
+
+/* Write a 16bit little endian integer. */
+static uint8_t *PutUint16(uint8_t *p, int value)
+{
+   p[0] = (uint8_t)(value & 0xff);
+   p[1] = (uint8_t)((value >> 8) & 0xff);
+   return p + 2;
+}
+
+/* Read a 16bit little endian integer. */
+static int GetUint16(const uint8_t *p)
+{
+   return p[0] | (p[1] << 8);
+}
+
+/* Encode bank header. */
+static void EncodeHeader(int count, uint8_t *header)
+{
+   uint8_t *p = header;
+
+   memcpy(p, BANK_MAGIC, 4);
+   p = PutUint16(p + 4, BANK_VERSION);
+   p = PutUint16(p, count);
+   p = PutUint16(p, COLLISION_TABLE_WIDTH);
+   p = PutUint16(p, COLLISION_TABLE_HEIGHT);
+   p = PutUint16(p, FLOOR_TABLE_WIDTH);
+   PutUint16(p, FLOOR_TABLE_HEIGHT);
+}
+
+/* Check bank header.  Returns map count, or -1 if header doesn't match
+   the current format and table dimensions.                             */
+static int DecodeHeader(const uint8_t *header)
+{
+   if( memcmp(header, BANK_MAGIC, 4) != 0 ||
+       GetUint16(header + 4) != BANK_VERSION ||
+       GetUint16(header + 8) != COLLISION_TABLE_WIDTH ||
+       GetUint16(header + 10) != COLLISION_TABLE_HEIGHT ||
+       GetUint16(header + 12) != FLOOR_TABLE_WIDTH ||
+       GetUint16(header + 14) != FLOOR_TABLE_HEIGHT )
+   {
+      return -1;
+   }
+   return GetUint16(header + 6);
+}
+
+/* Encode a single map record. */
+static void EncodeMap(const MapData *map, uint8_t *record)
+{
+   uint8_t *p = record;
+   int x, y;
+
+   memset(record, 0, MAP_RECORD_SIZE);
+   for(y = 0; y < COLLISION_TABLE_HEIGHT; y++)
+   {
+      for(x = 0; x < COLLISION_TABLE_WIDTH; x++)
+      {
+         if( map->walls[y * COLLISION_TABLE_WIDTH + x] != 0 )
+            p[x >> 3] |= (uint8_t)(1 << (x & 7));
+      }
+      p += WALL_ROW_BYTES;
+   }
+   memcpy(p, map->floor, FLOOR_SIZE);
+   p += FLOOR_SIZE;
+   p[0] = (uint8_t)map->special_x;
+   p[1] = (uint8_t)map->special_y;
+   p[2] = (uint8_t)map->special_variation;
+}
+
+/* Decode a single map record. */
+static void DecodeMap(const uint8_t *record, MapData *map)
+{
+   const uint8_t *p = record;
+   int x, y;
+
+   for(y = 0; y < COLLISION_TABLE_HEIGHT; y++)
+   {
+      for(x = 0; x < COLLISION_TABLE_WIDTH; x++)
+      {
+         map->walls[y * COLLISION_TABLE_WIDTH + x] =
+            (uint8_t)((p[x >> 3] >> (x & 7)) & 1);
+      }
+      p += WALL_ROW_BYTES;
+   }
+   memcpy(map->floor, p, FLOOR_SIZE);
+   p += FLOOR_SIZE;
+   map->special_x = p[0];
+   map->special_y = p[1];
+   map->special_variation = p[2];
+}
+
+/* Get time elapsed since start, in nanoseconds. */
+static int64_t ElapsedNanoseconds(const struct timespec *start)
+{
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (int64_t)(now.tv_sec - start->tv_sec) * 1000000000 +
+          (now.tv_nsec - start->tv_nsec);
+}
+
+/* Derive random state for map number "index". */
+static uint64_t MapSeed(uint64_t seed, int index)
+{
+   uint64_t state = (seed << 32) ^ (uint64_t)index;
+   return NextRandom(&state);
+}
+
+int main(int argc, char **argv)
+{
+   const char *output;
+   uint8_t *bank;
+   MapData *map, *decoded;
+   LoadedMap *expected, *loaded;
+   uint64_t seed = (uint64_t)time(NULL), state;
+   int count = DEFAULT_MAP_COUNT, i, status;
+   int64_t generate_ns = 0, load_ns = 0;
+   struct timespec start;
+   size_t bank_size;
+   FILE *outfile;
+
+   /* Parse command line arguments. */
+   for(i = 1; i < argc - 1; i += 2)
+   {
+      if( strcmp(argv[i], "--count") == 0 )
+      {
+         count = atoi(argv[i + 1]);
+      }
+      else if( strcmp(argv[i], "--seed") == 0 )
+      {
+         seed = (uint64_t)strtoull(argv[i + 1], NULL, 0);
+      }
+      else
+      {
+         break;
+      }
+   }
+   if( i != argc - 1 )
+   {
+      return printf("%s [--count {n}] [--seed {seed}] {output.bin}\n",
+                    *argv);
+   }
+   output = argv[i];
+   if( count < 1 || count > MAX_MAP_COUNT )
+   {
+      printf("Invalid count: %d (maximum is %d)\n", count, MAX_MAP_COUNT);
+      return 1;
+   }
+   if( strcmp(output, "-") == 0 && isatty(STDOUT_FILENO) )
+   {
+      fputs("Not writing output to stdout because it's a tty\n", stderr);
+      return 1;
+   }
+
+   bank_size = BANK_HEADER_SIZE + (size_t)count * MAP_RECORD_SIZE;
+   bank = (uint8_t*)malloc(bank_size);
+   map = (MapData*)malloc(sizeof(MapData) * 2);
+   expected = (LoadedMap*)calloc(2, sizeof(LoadedMap));
+   if( bank == NULL || map == NULL || expected == NULL )
+   {
+      puts("Out of memory");
+      exit(EXIT_FAILURE);
+   }
+   decoded = map + 1;
+   loaded = expected + 1;
+   InitWorldPositions();
+
+   /* Generate maps.  Each map is also run through the load-time steps,
+      so that generation time is comparable to init_walls_and_floors.   */
+   EncodeHeader(count, bank);
+   for(i = 0; i < count; i++)
+   {
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      state = MapSeed(seed, i);
+      GenerateMap(&state, map);
+      FinishMap(&state, map, expected);
+      generate_ns += ElapsedNanoseconds(&start);
+      EncodeMap(map, bank + BANK_HEADER_SIZE + (size_t)i * MAP_RECORD_SIZE);
+   }
+
+   /* Load each map back from the bank and verify the result.  The loader
+      uses a different random stream for its own steps, so we rerun
+      FinishMap on the generated map with the same stream for comparison. */
+   if( DecodeHeader(bank) != count )
+   {
+      fputs("Bank header mismatch\n", stderr);
+      return 1;
+   }
+   status = 0;
+   for(i = 0; i < count; i++)
+   {
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      state = (uint64_t)i;
+      DecodeMap(bank + BANK_HEADER_SIZE + (size_t)i * MAP_RECORD_SIZE,
+                decoded);
+      FinishMap(&state, decoded, loaded);
+      load_ns += ElapsedNanoseconds(&start);
+
+      state = MapSeed(seed, i);
+      GenerateMap(&state, map);
+      state = (uint64_t)i;
+      FinishMap(&state, map, expected);
+      if( memcmp(expected, loaded, sizeof(LoadedMap)) != 0 )
+      {
+         fprintf(stderr, "Map %d: loaded map does not match\n", i);
+         status = 1;
+      }
+   }
+   if( status != 0 )
+      return status;
+
+   /* Write output. */
+   if( strcmp(output, "-") == 0 )
+   {
+      #ifdef _WIN32
+         setmode(STDOUT_FILENO, O_BINARY);
+      #endif
+      outfile = stdout;
+   }
+   else if( (outfile = fopen(output, "wb")) == NULL )
+   {
+      fprintf(stderr, "Error writing %s\n", output);
+      return 1;
+   }
+   if( fwrite(bank, bank_size, 1, outfile) != 1 )
+      status = 1;
+   if( outfile == stdout ? fflush(stdout) != 0 : fclose(outfile) != 0 )
+      status = 1;
+   if( status != 0 )
+   {
+      fprintf(stderr, "Error writing %s\n", output);
+      if( outfile != stdout )
+         remove(output);
+      return status;
+   }
+
+   fprintf(stderr,
+           "Wrote %d map(s): %ld bytes (%d bytes per map)\n"
+           "Generate: %.1fus per map\n"
+           "Load: %.1fus per map\n",
+           count, (long)bank_size, MAP_RECORD_SIZE,
+           generate_ns / 1000.0 / count,
+           load_ns / 1000.0 / count);
+
+   free(bank);
+   free(map);
+   free(expected);
+   return 0;
+}
@@ -0,0 +1,236 @@
+#!/usr/bin/perl -w
+# Usage:
+#
+# ./generate_simulation_data.pl {data.lua} > {output.h}
+#
+# Convert tables used by game simulation from data.lua to C arrays, for
+# use by simulate_game.c.
+#
+# Tables are emitted with the same names and nesting as data.lua.  Lua
+# arrays are 1-based, so C code should subtract one from indices that
+# were 1-based in Lua.  Tables with explicit integer keys (coarse_atan)
+# are emitted as dense arrays covering the full key range, with a
+# "{name}_OFFSET" constant that should be added to the Lua keys, and
+# zeroes for keys that were not present.
+
+use strict;
+
+# Tables to convert.  Anything else in data.lua is ignored.
+use constant TABLES => qw(
+   velocity
+   average_velocity
+   slime_velocity
+   converge_angle
+   coarse_atan
+);
+
+# Scalars to convert.
+use constant SCALARS => qw(
+   coarse_atan_steps
+);
+
+
+# Parse a single Lua value from token list.  Returns array reference for
+# tables without explicit keys, hash reference for tables with explicit
+# integer keys, or the number itself.
+sub parse_value($);
+sub parse_value($)
+{
+   my ($tokens) = @_;
+
+   my $token = shift @$tokens;
+   defined $token or die "Unexpected end of input\n";
+   if( $token =~ /^-?\d+$/ )
+   {
+      return $token;
+   }
+   $token eq "{" or die "Unexpected token: $token\n";
+
+   my @array = ();
+   my %hash = ();
+   for(;;)
+   {
+      $token = $$tokens[0];
+      defined $token or die "Unexpected end of input\n";
+      if( $token eq "}" )
+      {
+         shift @$tokens;
+         last;
+      }
+      if( $token eq "," )
+      {
+         shift @$tokens;
+         next;
+      }
+      if( $token =~ /^\[(-?\d+)\]$/ )
+      {
+         shift @$tokens;
+         my $key = $1;
+         (shift @$tokens) eq "=" or die "Expected '=' after [$key]\n";
+         $hash{$key} = parse_value($tokens);
+      }
+      else
+      {
+         push @array, parse_value($tokens);
+      }
+   }
+   if( scalar keys %hash )
+   {
+      (scalar @array) == 0 or die "Mixed array and keyed table\n";
+      return \%hash;
+   }
+   return \@array;
+}
+
+# Convert a keyed table to array covering keys in the range of [min, max].
+sub keyed_to_array($$$)
+{
+   my ($hash, $min, $max) = @_;
+
+   my @array = ();
+   for(my $k = $min; $k <= $max; $k++)
+   {
+      push @array, exists $$hash{$k} ? $$hash{$k} : undef;
+   }
+   return \@array;
+}
+
+# Get dimensions of a nested array, checking that it's rectangular.
+sub get_dimensions($);
+sub get_dimensions($)
+{
+   my ($value) = @_;
+
+   return () unless ref $value;
+   my @inner;
+   foreach my $v (@$value)
+   {
+      next unless defined $v;
+      my @d = get_dimensions($v);
+      if( @inner )
+      {
+         "@inner" eq "@d" or die "Table is not rectangular\n";
+      }
+      else
+      {
+         @inner = @d;
+      }
+   }
+   return (scalar @$value, @inner);
+}
+
+# Output nested array contents.
+sub output_values($$$);
+sub output_values($$$)
+{
+   my ($value, $dimensions, $indent) = @_;
+
+   if( (scalar @$dimensions) == 1 )
+   {
+      print $indent, "{",
+            join(", ", map {defined $_ ? $_ : 0} @$value),
+            "}";
+      return;
+   }
+
+   my @inner = @$dimensions[1 .. $#$dimensions];
+   print $indent, "{\n";
+   for(my $i = 0; $i < scalar @$value; $i++)
+   {
+      if( defined $$value[$i] )
+      {
+         output_values($$value[$i], \@inner, "$indent   ");
+      }
+      else
+      {
+         my $size = 1;
+         $size *= $_ foreach @inner;
+         print "$indent   {", join(", ", (0) x $size), "}";
+      }
+      print $i < $#$value ? ",\n" : "\n";
+   }
+   print $indent, "}";
+}
+
+
+unless( $#ARGV == 0 )
+{
+   die "$0 {data.lua} > {output.h}\n";
+}
+
+# Load and tokenize input.
+my $text = "";
+open my $infile, "< $ARGV[0]" or die $!;
+while( my $line = <$infile> )
+{
+   $line =~ s/--.*$//;
+   $text .= $line;
+}
+close $infile;
+
+my %tables = ();
+my %scalars = ();
+while( $text =~ /^(\w+)\s*=\s*(-?\d+|\{)/mg )
+{
+   my $name = $1;
+   if( $2 ne "{" )
+   {
+      $scalars{$name} = $2;
+      next;
+   }
+
+   # Extract text for this table by counting braces.
+   my $start = pos($text) - 1;
+   my $depth = 0;
+   my $end = $start;
+   for(; $end < length($text); $end++)
+   {
+      my $c = substr($text, $end, 1);
+      if( $c eq "{" ) { $depth++; }
+      elsif( $c eq "}" ) { last if --$depth == 0; }
+   }
+   my @tokens = substr($text, $start, $end - $start + 1) =~
+                /(\{|\}|,|=|\[-?\d+\]|-?\d+)/g;
+   $tables{$name} = parse_value(\@tokens);
+   pos($text) = $end + 1;
+}
+
+print "/* Generated from $ARGV[0] by generate_simulation_data.pl */\n\n",
+      "#ifndef SIMULATION_DATA_H_\n",
+      "#define SIMULATION_DATA_H_\n\n";
+foreach my $name (SCALARS)
+{
+   exists $scalars{$name} or die "$name not found\n";
+   print "#define ", uc($name), " ", $scalars{$name}, "\n\n";
+}
+foreach my $name (TABLES)
+{
+   exists $tables{$name} or die "$name not found\n";
+   my $value = $tables{$name};
+   if( ref $value eq "HASH" )
+   {
+      # Use the same key range for all levels, so that the same offset
+      # applies to all indices.
+      my @keys = keys %$value;
+      foreach my $v (values %$value)
+      {
+         push @keys, keys %$v if ref $v eq "HASH";
+      }
+      @keys = sort {$a <=> $b} @keys;
+      my ($min, $max) = ($keys[0], $keys[$#keys]);
+
+      $value = keyed_to_array($value, $min, $max);
+      foreach my $v (@$value)
+      {
+         $v = keyed_to_array($v, $min, $max) if ref $v eq "HASH";
+      }
+      print "#define ", uc($name), "_OFFSET ", -$min, "\n";
+   }
+   my @dimensions = get_dimensions($value);
+   print "static const int $name",
+         (map {"[$_]"} @dimensions),
+         " =\n";
+   output_values($value, \@dimensions, "");
+   print ";\n\n";
+}
+print "#endif\n";
@@ -2,16 +2,35 @@
 
    Usage:
 
-      ./generate_test_floor_map.c {input-tile-table.png} {output.png}
+      ./generate_test_floor_map [--width {w}] [--height {h}] [--seed {seed}] \
+                                [--hash] [--threads {n}] \
+                                {input-tile-table.png} {output.png}
+
+   Map size is specified in tiles, and defaults to 16x9.  If seed is not
+   specified, current time is used.  Output is generated and written one
+   row of tiles at a time, so memory usage is proportional to map width.
+
+   By default, each tile's edges are carried over from the tiles above and
+   to the left through a single rand() sequence, so tiles must be
+   generated in order.  With "--hash", each edge is taken from a hash of
+   seed and tile coordinates instead, so any tile can be generated from
+   its coordinates alone.  Edges remain seamless because each shared edge
+   is read from the same hash by both tiles that touch it.  Hash mode
+   produces a different map from the default mode for the same seed.
+
+   "--threads" generates that many rows of tiles in parallel, and
+   requires "--hash".  Output is identical regardless of thread count,
+   and memory usage is multiplied by thread count.
 */
 
-#include<png.h>
 #include<stdint.h>
 #include<stdio.h>
 #include<stdlib.h>
 #include<string.h>
 #include<time.h>
 #include<unistd.h>
+#include"image_io.h"
+#include"worker_pool.h"
 
 #ifdef _WIN32
    #include<fcntl.h>
@@ -23,58 +42,142 @@
 #define TILE_IMAGE_WIDTH   (TILE_SIZE * 16)
 #define TILE_IMAGE_HEIGHT  (TILE_SIZE * 16)
 
-/* Output map size in tiles. */
-#define MAP_WIDTH       16
-#define MAP_HEIGHT      9
-#define IMAGE_WIDTH     (MAP_WIDTH * TILE_SIZE)
-#define IMAGE_HEIGHT    (MAP_HEIGHT * TILE_SIZE)
+/* Default output map size in tiles. */
+#define DEFAULT_MAP_WIDTH   16
+#define DEFAULT_MAP_HEIGHT  9
+
+/* Maximum map size in tiles.  This keeps the output image width within
+   the default libpng limit of 1000000 pixels.                          */
+#define MAX_MAP_SIZE        (1000000 / TILE_SIZE)
+
+/* Maximum number of threads for "--threads". */
+#define MAX_THREADS  64
 
-/* Pre-allocated buffers for pixel data. */
+/* Number of tiles in tile image. */
+#define TILE_COUNT  \
+   ((TILE_IMAGE_WIDTH / TILE_SIZE) * (TILE_IMAGE_HEIGHT / TILE_SIZE))
+
+/* Tile classes, used to select how each tile is drawn. */
+#define TILE_TRANSPARENT   0
+#define TILE_OPAQUE        1
+#define TILE_MIXED         2
+
+/* Pre-allocated buffers for tile pixel data.  tile_mask has the same
+   layout as tile_pixels, with both bytes of each pixel set to 0xff where
+   alpha is nonzero and 0 otherwise.                                     */
 static uint8_t tile_pixels[TILE_IMAGE_WIDTH * TILE_IMAGE_HEIGHT * 2];
-static uint8_t output_pixels[IMAGE_WIDTH * IMAGE_HEIGHT * 2];
+static uint8_t tile_mask[TILE_IMAGE_WIDTH * TILE_IMAGE_HEIGHT * 2];
+static uint8_t tile_class[TILE_COUNT];
+
+/* Map size in tiles. */
+static int map_width = DEFAULT_MAP_WIDTH;
+static int map_height = DEFAULT_MAP_HEIGHT;
 
-/* A single row of map cell data. */
-static int previous_row[MAP_WIDTH];
+/* Random seed, used directly by hash mode. */
+static unsigned int map_seed;
 
-/* Write tile to specified position in output_pixels. */
-static void WriteTile(int tile_index, int x, int y)
+/* Per-worker state for generating one row of tiles in hash mode. */
+typedef struct
 {
-   png_bytep p, q;
-   const int ty = (tile_index >> 4) * TILE_SIZE;
-   const int tx = (tile_index & 15) * TILE_SIZE;
-   int u, v;
+   /* TILE_SIZE scanlines of output, owned by this worker. */
+   uint8_t *band;
 
-   for(u = 0; u < TILE_SIZE; u++)
+   /* Row of tiles to generate, or -1 if there are no more rows. */
+   int y;
+} Worker;
+
+/* Build tile_mask and tile_class from tile_pixels. */
+static void ClassifyTiles()
+{
+   const uint8_t *p;
+   uint8_t *m;
+   int tile_index, offset, opaque, transparent, u, v;
+
+   for(tile_index = 0; tile_index < TILE_COUNT; tile_index++)
    {
-      p = tile_pixels + ((ty + u) * TILE_IMAGE_WIDTH + tx) * 2;
-      q = output_pixels + ((y + u) * IMAGE_WIDTH + x) * 2;
-      for(v = 0; v < TILE_SIZE; v++, p += 2, q += 2)
+      offset = (((tile_index >> 4) * TILE_SIZE) * TILE_IMAGE_WIDTH +
+                (tile_index & 15) * TILE_SIZE) * 2;
+      opaque = transparent = 1;
+      for(u = 0; u < TILE_SIZE; u++)
       {
-         if( p[1] != 0 )
+         p = tile_pixels + offset + u * TILE_IMAGE_WIDTH * 2;
+         m = tile_mask + offset + u * TILE_IMAGE_WIDTH * 2;
+         for(v = 0; v < TILE_SIZE; v++, p += 2, m += 2)
          {
-            q[0] = p[0];
-            q[1] = p[1];
+            if( p[1] != 0 )
+            {
+               m[0] = m[1] = 0xff;
+               transparent = 0;
+            }
+            else
+            {
+               m[0] = m[1] = 0;
+               opaque = 0;
+            }
          }
       }
+      tile_class[tile_index] = transparent ? TILE_TRANSPARENT :
+                               opaque ? TILE_OPAQUE : TILE_MIXED;
    }
 }
 
-/* Generate map tiles. */
-static void GenerateMap()
+/* Write tile to specified position in a row of tiles.  Pixels with zero
+   alpha are skipped, which is done by one of these methods depending on
+   tile class:
+
+   - Transparent tiles are skipped entirely.
+   - Opaque tiles are copied one row at a time.
+   - Mixed tiles are blended with tile_mask.  The inner loop is simple
+     enough that it gets vectorized by the compiler.                    */
+static void WriteTile(uint8_t *band, int tile_index, int x)
 {
+   const int offset = (((tile_index >> 4) * TILE_SIZE) * TILE_IMAGE_WIDTH +
+                       (tile_index & 15) * TILE_SIZE) * 2;
+   const int band_width = map_width * TILE_SIZE;
+   const uint8_t *p, *m;
+   uint8_t *q;
+   int u, v;
+
+   if( tile_class[tile_index] == TILE_TRANSPARENT )
+      return;
+
+   for(u = 0; u < TILE_SIZE; u++)
+   {
+      p = tile_pixels + offset + u * TILE_IMAGE_WIDTH * 2;
+      q = band + (u * band_width + x) * 2;
+      if( tile_class[tile_index] == TILE_OPAQUE )
+      {
+         memcpy(q, p, TILE_SIZE * 2);
+         continue;
+      }
+      m = tile_mask + offset + u * TILE_IMAGE_WIDTH * 2;
+      for(v = 0; v < TILE_SIZE * 2; v++)
+         q[v] = (q[v] & ~m[v]) | (p[v] & m[v]);
+   }
+}
+
+/* Generate map tiles and write one row of tiles at a time.  "band" holds
+   TILE_SIZE scanlines of output, and "previous_row" holds map_width cells.
+   Returns 1 on success.                                                  */
+static int GenerateMap(ImageWriter *writer, uint8_t *band, int *previous_row)
+{
+   const size_t band_row_size = (size_t)map_width * TILE_SIZE * 2;
    int x, y, previous_cell, cell;
 
    /* Generate a random invisible row. */
-   for(x = 0; x < MAP_WIDTH; x++)
+   for(x = 0; x < map_width; x++)
       previous_row[x] = rand() & 0xff;
 
    /* Generate rows. */
-   for(y = 0; y < MAP_HEIGHT; y++)
+   for(y = 0; y < map_height; y++)
    {
+      /* Start with fully transparent pixels. */
+      memset(band, 0, band_row_size * TILE_SIZE);
+
       /* Generate an invisible tile, which serves as the previous tile
          to the left of the first tile in this row.                    */
       previous_cell = rand() & 0xff;
-      for(x = 0; x < MAP_WIDTH; x++)
+      for(x = 0; x < map_width; x++)
       {
          /* Tile image indices follow this convention:
                      +-----+
@@ -91,22 +194,142 @@ static void GenerateMap()
          cell = ((previous_cell & 2) << 6) |
                 ((previous_row[x] & 1) << 6) |
                 (rand() & 0x3f);
-         WriteTile(cell, x * TILE_SIZE, y * TILE_SIZE);
+         WriteTile(band, cell, x * TILE_SIZE);
 
          previous_row[x] = cell;
          previous_cell = cell;
       }
+
+      for(x = 0; x < TILE_SIZE; x++)
+      {
+         if( !WriteImageRow(writer, band + x * band_row_size) )
+            return 0;
+      }
+   }
+   return 1;
+}
+
+/* Hash tile coordinates to 64 bits (splitmix64 finalizer).  Bit 0 is the
+   edge along the top of the tile, bit 1 is the edge along the left side,
+   and bits 2..5 are the random bits in the middle of the tile.  These
+   are at the same positions as the corresponding bits in tile index, see
+   GenerateMap.                                                          */
+static uint64_t TileHash(int x, int y)
+{
+   uint64_t z = (((uint64_t)(uint32_t)y << 32) | (uint32_t)x) ^
+                ((uint64_t)map_seed * 0xd1b54a32d192ed03ull);
+
+   z += 0x9e3779b97f4a7c15ull;
+   z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+   z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+   return z ^ (z >> 31);
+}
+
+/* Generate a single row of tiles in hash mode.  Bits 7 and 6 come from
+   the left and top edges of the current tile, bits 1 and 0 come from the
+   left edge of the tile to the right and the top edge of the tile below.
+   Tiles beyond the map edges are never drawn, but their edges are still
+   used so that the outermost tiles are as random as the rest.
+
+   "context" is the array of all workers.                               */
+static void GenerateHashedRow(void *context, int worker)
+{
+   const Worker *w = (const Worker*)context + worker;
+   uint64_t h;
+   int x, cell;
+
+   if( w->y < 0 )
+      return;
+   memset(w->band, 0, (size_t)map_width * TILE_SIZE * TILE_SIZE * 2);
+   for(x = 0; x < map_width; x++)
+   {
+      h = TileHash(x, w->y);
+      cell = (int)(((h & 2) << 6) | ((h & 1) << 6) | (h & 0x3c) |
+                   (TileHash(x + 1, w->y) & 2) |
+                   (TileHash(x, w->y + 1) & 1));
+      WriteTile(w->band, cell, x * TILE_SIZE);
+   }
+}
+
+/* Generate map tiles in hash mode, using one worker per thread.  Each
+   worker generates one row of tiles per iteration, and the rows are
+   written in order after all workers are done.  Returns 1 on success.  */
+static int GenerateHashedMap(ImageWriter *writer, Worker *workers,
+                             int thread_count)
+{
+   const size_t band_row_size = (size_t)map_width * TILE_SIZE * 2;
+   WorkerPool pool;
+   int y, i, count, u, ok;
+
+   StartWorkerPool(&pool, thread_count);
+   ok = 1;
+   for(y = 0; ok && y < map_height; y += thread_count)
+   {
+      count = map_height - y < thread_count ? map_height - y : thread_count;
+      for(i = 0; i < thread_count; i++)
+         workers[i].y = i < count ? y + i : -1;
+      RunWorkerPool(&pool, GenerateHashedRow, workers);
+
+      for(i = 0; ok && i < count; i++)
+      {
+         for(u = 0; ok && u < TILE_SIZE; u++)
+            ok = WriteImageRow(writer, workers[i].band + u * band_row_size);
+      }
    }
+   StopWorkerPool(&pool);
+   return ok;
 }
 
 int main(int argc, char **argv)
 {
-   png_image tiles_image, output_image;
+   ImageReader reader;
+   ImageWriter writer;
+   Worker workers[MAX_THREADS];
+   uint8_t *band;
+   int *previous_row;
+   int arg, y, hash_mode, thread_count, ok;
 
-   if( argc != 3 )
-      return printf("%s {input-tile-table.png} {output.png}\n", *argv);
+   map_seed = (unsigned int)time(NULL);
+   hash_mode = 0;
+   thread_count = 1;
+   for(arg = 1; arg + 2 < argc; arg += 2)
+   {
+      if( strcmp(argv[arg], "--hash") == 0 )
+      {
+         hash_mode = 1;
+         arg--;
+      }
+      else if( strcmp(argv[arg], "--width") == 0 )
+         map_width = atoi(argv[arg + 1]);
+      else if( strcmp(argv[arg], "--height") == 0 )
+         map_height = atoi(argv[arg + 1]);
+      else if( strcmp(argv[arg], "--seed") == 0 )
+         map_seed = (unsigned int)strtoul(argv[arg + 1], NULL, 10);
+      else if( strcmp(argv[arg], "--threads") == 0 )
+         thread_count = atoi(argv[arg + 1]);
+      else
+         break;
+   }
+   if( arg + 2 != argc )
+   {
+      return printf("%s [--width {w}] [--height {h}] [--seed {seed}] "
+                    "[--hash] [--threads {n}] "
+                    "{input-tile-table.png} {output.png}\n", *argv);
+   }
+   if( map_width < 1 || map_width > MAX_MAP_SIZE ||
+       map_height < 1 || map_height > MAX_MAP_SIZE )
+   {
+      printf("Invalid map size: %d,%d\n", map_width, map_height);
+      return 1;
+   }
+   if( thread_count < 1 || thread_count > MAX_THREADS ||
+       (thread_count > 1 && !hash_mode) )
+   {
+      printf("Invalid thread count: %d\n", thread_count);
+      return 1;
+   }
 
-   if( strcmp(argv[2], "-") == 0 && isatty(STDOUT_FILENO) )
+   if( strcmp(argv[arg + 1], "-") == 0 && isatty(STDOUT_FILENO) )
    {
       fputs("Not writing output to stdout because it's a tty\n", stderr);
       return 1;
@@ -115,53 +338,67 @@ int main(int argc, char **argv)
       setmode(STDOUT_FILENO, O_BINARY);
    #endif
 
-   srand(time(NULL));
+   srand(map_seed);
 
    /* Load tile image. */
-   memset(&tiles_image, 0, sizeof(tiles_image));
-   tiles_image.version = PNG_IMAGE_VERSION;
-   if( !png_image_begin_read_from_file(&tiles_image, argv[1]) )
-      return printf("Error reading %s\n", argv[1]);
-   tiles_image.format = PNG_FORMAT_GA;
-   if( tiles_image.width != TILE_IMAGE_WIDTH ||
-       tiles_image.height != TILE_IMAGE_HEIGHT )
+   if( !OpenImageReader(&reader, argv[arg]) )
+      return printf("Error reading %s\n", argv[arg]);
+   if( reader.width != TILE_IMAGE_WIDTH || reader.height != TILE_IMAGE_HEIGHT )
    {
       printf("Unexpected tile image size: expected %d,%d, got %d,%d\n",
-             TILE_IMAGE_WIDTH, TILE_IMAGE_HEIGHT,
-             (int)tiles_image.width, (int)tiles_image.height);
+             TILE_IMAGE_WIDTH, TILE_IMAGE_HEIGHT, reader.width, reader.height);
+      CloseImageReader(&reader);
       return 1;
    }
-   if( !png_image_finish_read(&tiles_image, NULL, tile_pixels, 0, NULL) )
-      return printf("Error loading %s\n", argv[1]);
-
-   /* Create map image. */
-   memset(&output_image, 0, sizeof(output_image));
-   output_image.version = PNG_IMAGE_VERSION;
-   output_image.format = PNG_FORMAT_GA;
-   output_image.width = IMAGE_WIDTH;
-   output_image.height = IMAGE_HEIGHT;
-
-   /* Generate map tiles. */
-   GenerateMap();
-
-   /* Write output. */
-   if( strcmp(argv[2], "-") == 0 )
+   for(y = 0; y < TILE_IMAGE_HEIGHT; y++)
    {
-      if( !png_image_write_to_stdio(
-             &output_image, stdout, 0, output_pixels, 0, NULL) )
+      if( !ReadImageRow(&reader, tile_pixels + y * TILE_IMAGE_WIDTH * 2) )
       {
-         fputs("Error writing to stdout\n", stderr);
-         return 1;
+         CloseImageReader(&reader);
+         return printf("Error loading %s\n", argv[arg]);
       }
    }
-   else
+   CloseImageReader(&reader);
+   ClassifyTiles();
+
+   /* Allocate one band per thread.  Default mode only uses the first
+      band.  There is no point in having more threads than rows.        */
+   if( thread_count > map_height )
+      thread_count = map_height;
+   ok = 1;
+   for(y = 0; y < thread_count; y++)
    {
-      if( !png_image_write_to_file(
-             &output_image, argv[2], 0, output_pixels, 0, NULL) )
-      {
-         printf("Error writing %s\n", argv[2]);
-         return 1;
-      }
+      workers[y].band = (uint8_t*)malloc(
+         (size_t)map_width * TILE_SIZE * TILE_SIZE * 2);
+      if( workers[y].band == NULL )
+         ok = 0;
+   }
+   band = workers[0].band;
+   previous_row = (int*)malloc(map_width * sizeof(int));
+   if( !ok || previous_row == NULL )
+   {
+      for(y = 0; y < thread_count; y++)
+         free(workers[y].band);
+      free(previous_row);
+      return puts("Out of memory");
+   }
+
+   /* Generate map tiles and write output. */
+   if( !OpenImageWriter(&writer, argv[arg + 1],
+                        map_width * TILE_SIZE, map_height * TILE_SIZE) ||
+       !(hash_mode ? GenerateHashedMap(&writer, workers, thread_count)
+                   : GenerateMap(&writer, band, previous_row)) ||
+       !CloseImageWriter(&writer) )
+   {
+      CloseImageWriter(&writer);
+      if( strcmp(argv[arg + 1], "-") == 0 )
+         fputs("Error writing to stdout\n", stderr);
+      else
+         printf("Error writing %s\n", argv[arg + 1]);
+      ok = 0;
    }
-   return 0;
+   for(y = 0; y < thread_count; y++)
+      free(workers[y].band);
+   free(previous_row);
+   return ok ? 0 : 1;
 }
@@ -2,7 +2,24 @@
 
    Usage:
 
-      ./generate_test_wall_map.c {input-tile-table.png} {output.png}
+      ./generate_test_wall_map [--width {w}] [--height {h}] [--seed {seed}] \
+                               [--budget {us}] [--phase-times] \
+                               {input-tile-table.png} {output.png}
+
+   Map size is specified in tiles, and defaults to 160x160.  If seed is not
+   specified, current time is used.  Output is written one row of tiles at
+   a time, so memory usage is proportional to the number of map cells, and
+   not the number of output pixels.
+
+   With "--budget", map generation is run in slices of approximately the
+   specified number of microseconds, and slice times are reported to
+   stderr.  Output is the same with or without a budget.  This is the
+   background generation scheme mentioned below, see MapGenerator.
+
+   With "--phase-times", total time spent in each generation phase and in
+   writing output pixels is reported to stderr, one line per phase:
+
+      phase {name} {microseconds}
 
    This code uses the cave generation algorithm from here:
    https://www.roguebasin.com/index.php/Cellular_Automata_Method_for_Generating_Random_Cave-Like_Levels
@@ -26,13 +43,13 @@
    objects can eventually make a path to wherever they want to go.
 */
 
-#include<png.h>
 #include<stdint.h>
 #include<stdio.h>
 #include<stdlib.h>
 #include<string.h>
 #include<time.h>
 #include<unistd.h>
+#include"image_io.h"
 
 #ifdef _WIN32
    #include<fcntl.h>
@@ -50,314 +67,774 @@
 /* Index of solid wall tile. */
 #define WALL_TILE_INDEX    0x80
 
-/* Output map size in tiles. */
-#define MAP_WIDTH       160
-#define MAP_HEIGHT      160
-#define IMAGE_WIDTH     (MAP_WIDTH * TILE_SIZE)
-#define IMAGE_HEIGHT    (MAP_HEIGHT * TILE_SIZE)
+/* Default output map size in tiles. */
+#define DEFAULT_MAP_WIDTH   160
+#define DEFAULT_MAP_HEIGHT  160
+
+/* Maximum map size in tiles. */
+#define MAX_MAP_SIZE        16384
+
+/* Number of tiles in tile image. */
+#define TILE_COUNT  \
+   ((TILE_IMAGE_WIDTH / TILE_SIZE) * (TILE_IMAGE_HEIGHT / TILE_SIZE))
 
-/* Pre-allocated buffers for pixel data. */
+/* Tile classes, used to select how each tile is drawn. */
+#define TILE_TRANSPARENT   0
+#define TILE_OPAQUE        1
+#define TILE_MIXED         2
+
+/* Pre-allocated buffers for tile pixel data.  tile_mask has the same
+   layout as tile_pixels, with both bytes of each pixel set to 0xff where
+   alpha is nonzero and 0 otherwise.                                     */
 static uint8_t tile_pixels[TILE_IMAGE_WIDTH * TILE_IMAGE_HEIGHT * 2];
-static uint8_t output_pixels[IMAGE_WIDTH * IMAGE_HEIGHT * 2];
+static uint8_t tile_mask[TILE_IMAGE_WIDTH * TILE_IMAGE_HEIGHT * 2];
+static uint8_t tile_class[TILE_COUNT];
+
+/* Map size in tiles. */
+static int map_width = DEFAULT_MAP_WIDTH;
+static int map_height = DEFAULT_MAP_HEIGHT;
+
+/* Bit-packed map cells, 64 cells per word, with bit (x % 64) of word
+   (x / 64) holding the cell at column x.  Each row has one padding word
+   on either side, and there is one padding row above and below the map.
+   For bitboards holding walls, all padding bits are set, so that cells
+   outside of the map are read as walls without any bounds checking.
+   Other bitboards have all padding bits cleared.                        */
+#define BITBOARD_WORDS   ((map_width + 63) / 64)
+#define BITBOARD_STRIDE  (BITBOARD_WORDS + 2)
+#define BITBOARD_SIZE    (BITBOARD_STRIDE * (map_height + 2))
+
+/* Bits in the last word of each row that are beyond map_width. */
+#define BITBOARD_TAIL_PADDING  \
+   ((map_width % 64) == 0 ? 0 : ~(uint64_t)0 << (map_width % 64))
+
+/* Get pointer to first map cell word in a row of bitboard. */
+#define BITBOARD_ROW(bitboard, y)  \
+   ((bitboard) + ((y) + 1) * BITBOARD_STRIDE + 1)
+
+/* Count cells in 3 horizontally adjacent columns for all bits in a word,
+   producing a 2bit sum for each bit position.                            */
+static void HorizontalSum(const uint64_t *row,
+                          uint64_t *sum0,
+                          uint64_t *sum1)
+{
+   const uint64_t left = (row[0] << 1) | (row[-1] >> 63);
+   const uint64_t right = (row[0] >> 1) | (row[1] << 63);
 
-/* Map data.  1=wall, 0=empty. */
-static uint8_t map_data[MAP_HEIGHT][MAP_WIDTH];
-#define MAP_DATA(x, y)  \
-   ( (x) < 0 || (x) >= MAP_WIDTH || (y) < 0 || (y) >= MAP_HEIGHT  \
-     ? 1 : map_data[y][x] )
+   *sum0 = left ^ row[0] ^ right;
+   *sum1 = (left & row[0]) | (right & (left ^ row[0]));
+}
 
-/* Stack of XY coordinates, for use with FillMapHoles. */
-typedef struct { int x, y; } XY;
-typedef struct
+/* Get bits that are set in any of 3 horizontally adjacent columns. */
+static uint64_t HorizontalOr(const uint64_t *row)
 {
-   XY *s;
-   int size, capacity;
-} VisitStack;
+   return row[0] | (row[0] << 1) | (row[-1] >> 63) |
+                   (row[0] >> 1) | (row[1] << 63);
+}
 
-/* Push item onto stack. */
-static void Push(VisitStack *stack, int x, int y)
+/* Populate one row of cells with random values.  Cells are generated in
+   the same order as a plain 2D array of cells, one rand() call per cell,
+   so the map for a given seed doesn't depend on how generation is split
+   into slices.                                                          */
+static void RandomFillRow(uint64_t *bitboard, int y)
 {
-   if( stack->size >= stack->capacity )
+   uint64_t *row = BITBOARD_ROW(bitboard, y);
+   int x, w;
+
+   for(w = 0; w < BITBOARD_WORDS; w++)
+      row[w] = 0;
+   row[BITBOARD_WORDS - 1] = BITBOARD_TAIL_PADDING;
+   for(x = 0; x < map_width; x++)
    {
-      if( stack->capacity == 0 )
-      {
-         stack->capacity = 16;
-      }
-      else
-      {
-         stack->capacity *= 2;
-      }
-      stack->s = realloc(stack->s, stack->capacity * sizeof(XY));
-      if( stack->s == NULL )
-      {
-         printf("Not enough memory for %d elements\n", stack->capacity);
-         exit(EXIT_FAILURE);
-      }
+      if( ((float)rand() / (float)RAND_MAX) < 0.45 )
+         row[x / 64] |= (uint64_t)1 << (x % 64);
    }
-   stack->s[stack->size].x = x;
-   stack->s[stack->size].y = y;
-   stack->size++;
 }
 
-/* Pop top item off of the stack. */
-static void Pop(VisitStack *stack, int *x, int *y)
-{
-   stack->size--;
-   *x = stack->s[stack->size].x;
-   *y = stack->s[stack->size].y;
-}
+/* Apply one smoothing iteration to one row of cells.
 
-/* Syntactic sugar. */
-static void Destroy(VisitStack *stack)
+   Each cell becomes a wall if there are more than 4 walls in the 3x3
+   neighborhood centered at that cell.  This is done 64 cells at a time
+   with bit-sliced arithmetic: each row of 3 cells is summed to 2 bits,
+   the low bits of the 3 rows are summed to a 1 bit plus a carry, and the
+   count is greater than 4 if at least 3 of the 4 remaining weight-2 bits
+   are set, or if 2 of them are set plus the weight-1 bit.                */
+static void SmoothRow(const uint64_t *current, uint64_t *next, int y)
 {
-   free(stack->s);
-   memset(stack, 0, sizeof(VisitStack));
+   uint64_t a0, a1, b0, b1, c0, c1, ones, carry, ab_and, ab_or, cd_and, cd_or;
+   int w;
+
+   for(w = 0; w < BITBOARD_WORDS; w++)
+   {
+      HorizontalSum(BITBOARD_ROW(current, y - 1) + w, &a0, &a1);
+      HorizontalSum(BITBOARD_ROW(current, y) + w, &b0, &b1);
+      HorizontalSum(BITBOARD_ROW(current, y + 1) + w, &c0, &c1);
+
+      ones = a0 ^ b0 ^ c0;
+      carry = (a0 & b0) | (c0 & (a0 ^ b0));
+
+      /* At least 3 of {a1, b1, c1, carry}, or at least 2 plus ones. */
+      ab_and = a1 & b1;
+      ab_or = a1 | b1;
+      cd_and = c1 & carry;
+      cd_or = c1 | carry;
+      BITBOARD_ROW(next, y)[w] =
+         (ab_and & cd_or) | (cd_and & ab_or) |
+         ((ab_and | cd_and | (ab_or & cd_or)) & ones);
+   }
+   BITBOARD_ROW(next, y)[BITBOARD_WORDS - 1] |= BITBOARD_TAIL_PADDING;
 }
 
-/* Populate cells with random values. */
-static void GenerateRandomMapCells()
+/* Run of horizontally adjacent cells from x0 to x1 (inclusive) in row y,
+   for use with FillMapHoles.                                             */
+typedef struct
 {
-   int x, y;
+   int x0, x1, y;
+} Span;
 
-   for(y = 0; y < MAP_HEIGHT; y++)
+/* Find the first x in [x, x_end] where bit is set in "bitboard" and not
+   set in "mask".  Returns x_end+1 if there are no such cells.           */
+static int FindNextBit(const uint64_t *bitboard, const uint64_t *mask,
+                       int x, int x_end, int y)
+{
+   const uint64_t *row = BITBOARD_ROW(bitboard, y);
+   const uint64_t *mask_row = BITBOARD_ROW(mask, y);
+   uint64_t bits;
+   int w;
+
+   w = x / 64;
+   bits = row[w] & ~mask_row[w] & (~(uint64_t)0 << (x % 64));
+   while( bits == 0 )
    {
-      for(x = 0; x < MAP_WIDTH; x++)
-         map_data[y][x] = ((float)rand() / (float)RAND_MAX) < 0.45 ? 1 : 0;
+      if( ++w > x_end / 64 )
+         return x_end + 1;
+      bits = row[w] & ~mask_row[w];
    }
+   x = w * 64 + __builtin_ctzll(bits);
+   return x <= x_end ? x : x_end + 1;
 }
 
-/* Iteratively apply smoothing to map data. */
-static void SmoothMapCells()
+/* Double the size of span stack.
+
+   Each span is pushed at most once, and spans in the same row are
+   separated by at least one cell, so the stack never needs to hold more
+   than map_height * ceil(map_width / 2) entries.                        */
+static Span *GrowStack(Span *stack, int *capacity)
 {
-   uint8_t *buffer, *p;
-   int x, y, i, count;
+   const int limit = map_height * ((map_width + 1) / 2);
 
-   buffer = (uint8_t*)malloc(MAP_WIDTH * MAP_HEIGHT);
-   if( buffer == NULL )
+   *capacity = *capacity * 2 < limit ? *capacity * 2 : limit;
+   stack = (Span*)realloc(stack, *capacity * sizeof(Span));
+   if( stack == NULL )
    {
       puts("Out of memory");
       exit(EXIT_FAILURE);
    }
-   for(i = 0; i < 4; i++)
-   {
-      /* Compute new map cells from existing map cells. */
-      p = buffer;
-      for(y = 0; y < MAP_HEIGHT; y++)
-      {
-         for(x = 0; x < MAP_WIDTH; x++, p++)
-         {
-            count = MAP_DATA(x - 1, y - 1) +
-                    MAP_DATA(x,     y - 1) +
-                    MAP_DATA(x + 1, y - 1) +
-                    MAP_DATA(x - 1, y    ) +
-                    MAP_DATA(x,     y    ) +
-                    MAP_DATA(x + 1, y    ) +
-                    MAP_DATA(x - 1, y + 1) +
-                    MAP_DATA(x,     y + 1) +
-                    MAP_DATA(x + 1, y + 1);
-            *p = (count <= 4 ? 0 : 1);
-         }
-      }
+   return stack;
+}
+
+/* Find the span of open cells containing (x,y), mark all cells in that
+   span as visited, and push the span onto the stack.
 
-      /* Overwrite the old map data with new data.  A more efficient
-         approach would be to have a double-buffered approach to avoid
-         copying after each iteration, but for this test program, we
-         just want to do what's convenient.                            */
-      memcpy(&map_data[0][0], buffer, MAP_WIDTH * MAP_HEIGHT);
+   The span ends are found a word at a time by looking for the nearest
+   cleared bits in "open".  Since the padding bits are all clear, the
+   search always stops at the map edges.                                */
+static void PushSpan(const uint64_t *open, uint64_t *visited, int x, int y,
+                     Span *stack, int *stack_size)
+{
+   const uint64_t *row = BITBOARD_ROW(open, y);
+   uint64_t *visited_row = BITBOARD_ROW(visited, y);
+   Span *s = stack + (*stack_size)++;
+   uint64_t bits;
+   int w;
+
+   s->y = y;
+
+   /* Find left end. */
+   w = x / 64;
+   bits = ~row[w] & (((uint64_t)1 << (x % 64)) - 1);
+   while( bits == 0 )
+      bits = ~row[--w];
+   s->x0 = w * 64 + 64 - __builtin_clzll(bits);
+
+   /* Find right end. */
+   w = x / 64;
+   bits = ~row[w] & (~(uint64_t)0 << (x % 64));
+   while( bits == 0 )
+      bits = ~row[++w];
+   s->x1 = w * 64 + __builtin_ctzll(bits) - 1;
+
+   /* Mark span as visited. */
+   for(w = s->x0 / 64; w <= s->x1 / 64; w++)
+   {
+      bits = ~(uint64_t)0;
+      if( w == s->x0 / 64 )
+         bits &= ~(uint64_t)0 << (s->x0 % 64);
+      if( w == s->x1 / 64 )
+         bits &= ~(uint64_t)0 >> (63 - s->x1 % 64);
+      visited_row[w] |= bits;
    }
-   free(buffer);
 }
 
-/* Seal off inaccessible areas.  Returns 0 on success. */
-static void FillMapHoles()
+/* Carve out a 3x3 space at the center of the map.  We will start the
+   flood fill process from there.                                     */
+static void CarveCenter(uint64_t *walls)
 {
-   static const XY offsets[8] =
+   const int x = map_width / 2, y = map_height / 2;
+   int i, j;
+
+   for(i = y - 1; i <= y + 1; i++)
    {
-      {1, 0}, {0, 1}, {-1, 0}, {0, -1}, {1, 1}, {-1, 1}, {-1, -1}, {1, -1}
-   };
-   VisitStack fill_stack;
-   uint8_t *accessible_spots, *p;
-   int x, y, i;
-
-   memset(&fill_stack, 0, sizeof(VisitStack));
-
-   /* Carve out a 3x3 space at the center of the map.  We will start
-      the flood fill process from there.                             */
-   x = MAP_WIDTH / 2;
-   y = MAP_HEIGHT / 2;
-   map_data[y - 1][x - 1] = 0;
-   map_data[y - 1][x    ] = 0;
-   map_data[y - 1][x + 1] = 0;
-   map_data[y    ][x - 1] = 0;
-   map_data[y    ][x    ] = 0;
-   map_data[y    ][x + 1] = 0;
-   map_data[y + 1][x - 1] = 0;
-   map_data[y + 1][x    ] = 0;
-   map_data[y + 1][x + 1] = 0;
-   Push(&fill_stack, x, y);
-
-   accessible_spots = (uint8_t*)calloc(MAP_WIDTH * MAP_HEIGHT, 1);
-   if( accessible_spots == NULL )
+      for(j = x - 1; j <= x + 1; j++)
+         BITBOARD_ROW(walls, i)[j / 64] &= ~((uint64_t)1 << (j % 64));
+   }
+}
+
+/* Compute one row of open cells for the flood fill.
+
+   Typical flood fills operate a pixel at a time, which is the same as
+   painting an area with an 1x1 brush.  Because we need wider space to
+   guarantee accessibility, we paint with a 3x3 brush, and only mark a
+   cell as visited if it's the center of an empty 3x3 space.
+
+   This is done by first eroding the empty space, such that only cells
+   at the center of an empty 3x3 space are open, and then doing a
+   regular 8-way flood fill over the open cells.  Cells that are within
+   the 3x3 brush of any visited cell are accessible.                   */
+static void ErodeRow(const uint64_t *walls, uint64_t *open, int y)
+{
+   int w;
+
+   for(w = 0; w < BITBOARD_WORDS; w++)
    {
-      puts("Out of memory");
-      exit(EXIT_FAILURE);
+      BITBOARD_ROW(open, y)[w] =
+         ~(HorizontalOr(BITBOARD_ROW(walls, y - 1) + w) |
+           HorizontalOr(BITBOARD_ROW(walls, y) + w) |
+           HorizontalOr(BITBOARD_ROW(walls, y + 1) + w));
    }
+}
+
+/* Compute one row of accessible cells, by applying 3x3 brush to all
+   visited cells.
 
-   /* Apply flood fill with a thick brush, marking accessible cells with
-      two bits:
-      1 = current cell is accessible.  If this bit is set, it means this
-          cell is at the center of an empty 3x3 space.
-      2 = neighboring cell is accessible.
-
-      Typical flood fills operate a pixel at a time, which is the same as
-      painting an area with an 1x1 brush.  Because we need wider space to
-      guarantee accessibility, we paint with a 3x3 brush, and only mark a
-      cell if it's the center of an empty 3x3 space.
-
-      Because we are using a wider brush, the usual 1-bit-per-cell scheme
-      for tracking is not sufficient -- we need a bit to track cells that
-      have been visited, plus one separate bit to track cells that are
-      neighbors of the visited cell.                                      */
-   while( fill_stack.size > 0 )
+   Also find all inaccessible spots that have exactly one orthogonal
+   empty neighbor, and mark those accessible.  Those are in fact not
+   accessible, but we want to leave those single cell holes open
+   because they make the map look more interesting.                  */
+static void BrushRow(const uint64_t *walls, const uint64_t *visited,
+                     uint64_t *accessible, int y)
+{
+   uint64_t up, down, left, right, three_walls;
+   int w;
+
+   for(w = 0; w < BITBOARD_WORDS; w++)
    {
-      /* Mark newly accessible spot. */
-      Pop(&fill_stack, &x, &y);
-      if( (accessible_spots[y * MAP_WIDTH + x] & 1) != 0 )
-         continue;
-      accessible_spots[y * MAP_WIDTH + x] = 1;
-      #define MARK_ACCESSIBLE_NEIGHBOR(x, y)  \
-         if( (x) >= 0 && (x) < MAP_WIDTH &&                 \
-             (y) >= 0 && (y) < MAP_HEIGHT )                 \
-         {                                                  \
-            accessible_spots[(y) * MAP_WIDTH + (x)] |= 2;   \
-         }
-      MARK_ACCESSIBLE_NEIGHBOR(x + 1, y    )
-      MARK_ACCESSIBLE_NEIGHBOR(x + 1, y + 1)
-      MARK_ACCESSIBLE_NEIGHBOR(x,     y + 1)
-      MARK_ACCESSIBLE_NEIGHBOR(x - 1, y + 1)
-      MARK_ACCESSIBLE_NEIGHBOR(x - 1, y    )
-      MARK_ACCESSIBLE_NEIGHBOR(x - 1, y - 1)
-      MARK_ACCESSIBLE_NEIGHBOR(x,     y - 1)
-      MARK_ACCESSIBLE_NEIGHBOR(x + 1, y - 1)
-      #undef MARK_ACCESSIBLE_NEIGHBOR
+      up = BITBOARD_ROW(walls, y - 1)[w];
+      down = BITBOARD_ROW(walls, y + 1)[w];
+      left = (BITBOARD_ROW(walls, y)[w] << 1) |
+             (BITBOARD_ROW(walls, y)[w - 1] >> 63);
+      right = (BITBOARD_ROW(walls, y)[w] >> 1) |
+              (BITBOARD_ROW(walls, y)[w + 1] << 63);
+      three_walls = ((up & down & (left | right)) |
+                     (left & right & (up | down))) &
+                    ~(up & down & left & right);
+      BITBOARD_ROW(accessible, y)[w] =
+         HorizontalOr(BITBOARD_ROW(visited, y - 1) + w) |
+         HorizontalOr(BITBOARD_ROW(visited, y) + w) |
+         HorizontalOr(BITBOARD_ROW(visited, y + 1) + w) |
+         three_walls;
+   }
+}
 
-      for(i = 0; i < 8; i++)
+/* Fill all empty spots in one row that are not accessible. */
+static void SealRow(uint64_t *walls, const uint64_t *accessible, int y)
+{
+   int w;
+
+   for(w = 0; w < BITBOARD_WORDS; w++)
+      BITBOARD_ROW(walls, y)[w] |= ~BITBOARD_ROW(accessible, y)[w];
+}
+
+/* Build tile_mask and tile_class from tile_pixels. */
+static void ClassifyTiles()
+{
+   const uint8_t *p;
+   uint8_t *m;
+   int tile_index, offset, opaque, transparent, u, v;
+
+   for(tile_index = 0; tile_index < TILE_COUNT; tile_index++)
+   {
+      offset = (((tile_index >> 4) * TILE_SIZE) * TILE_IMAGE_WIDTH +
+                (tile_index & 15) * TILE_SIZE) * 2;
+      opaque = transparent = 1;
+      for(u = 0; u < TILE_SIZE; u++)
       {
-         if( MAP_DATA(x + offsets[i].x, y + offsets[i].y) == 0 &&
-             MAP_DATA(x + offsets[i].x + 1, y + offsets[i].y    ) == 0 &&
-             MAP_DATA(x + offsets[i].x + 1, y + offsets[i].y + 1) == 0 &&
-             MAP_DATA(x + offsets[i].x,     y + offsets[i].y + 1) == 0 &&
-             MAP_DATA(x + offsets[i].x - 1, y + offsets[i].y + 1) == 0 &&
-             MAP_DATA(x + offsets[i].x - 1, y + offsets[i].y    ) == 0 &&
-             MAP_DATA(x + offsets[i].x - 1, y + offsets[i].y - 1) == 0 &&
-             MAP_DATA(x + offsets[i].x,     y + offsets[i].y - 1) == 0 &&
-             MAP_DATA(x + offsets[i].x + 1, y + offsets[i].y - 1) == 0 )
+         p = tile_pixels + offset + u * TILE_IMAGE_WIDTH * 2;
+         m = tile_mask + offset + u * TILE_IMAGE_WIDTH * 2;
+         for(v = 0; v < TILE_SIZE; v++, p += 2, m += 2)
          {
-            Push(&fill_stack, x + offsets[i].x, y + offsets[i].y);
+            if( p[1] != 0 )
+            {
+               m[0] = m[1] = 0xff;
+               transparent = 0;
+            }
+            else
+            {
+               m[0] = m[1] = 0;
+               opaque = 0;
+            }
          }
       }
+      tile_class[tile_index] = transparent ? TILE_TRANSPARENT :
+                               opaque ? TILE_OPAQUE : TILE_MIXED;
    }
-   Destroy(&fill_stack);
-
-   /* Find all inaccessible spots that have exactly one orthogonal empty
-      neighbor, and mark those accessible.  Those are in fact not
-      accessible, but we want to leave those single cell holes open
-      because they make the map look more interesting.                   */
-   p = accessible_spots;
-   for(y = 0; y < MAP_HEIGHT; y++)
+}
+
+/* Write tile to specified position in a row of tiles.  Pixels with zero
+   alpha are skipped, which is done by one of these methods depending on
+   tile class:
+
+   - Transparent tiles are skipped entirely.
+   - Opaque tiles are copied one row at a time.
+   - Mixed tiles are blended with tile_mask.  The inner loop is simple
+     enough that it gets vectorized by the compiler.                    */
+static void WriteTile(uint8_t *band, int tile_index, int x)
+{
+   const int offset = (((tile_index >> 4) * TILE_SIZE) * TILE_IMAGE_WIDTH +
+                       (tile_index & 15) * TILE_SIZE) * 2;
+   const int band_width = map_width * TILE_SIZE;
+   const uint8_t *p, *m;
+   uint8_t *q;
+   int u, v;
+
+   if( tile_class[tile_index] == TILE_TRANSPARENT )
+      return;
+
+   for(u = 0; u < TILE_SIZE; u++)
    {
-      for(x = 0; x < MAP_WIDTH; x++, p++)
+      p = tile_pixels + offset + u * TILE_IMAGE_WIDTH * 2;
+      q = band + (u * band_width + x) * 2;
+      if( tile_class[tile_index] == TILE_OPAQUE )
       {
-         if( map_data[y][x] == 0 && *p == 0 &&
-             MAP_DATA(x + 1, y    ) +
-             MAP_DATA(x,     y + 1) +
-             MAP_DATA(x - 1, y    ) +
-             MAP_DATA(x,     y - 1) == 3 )
-         {
-            *p = 1;
-         }
+         memcpy(q, p, TILE_SIZE * 2);
+         continue;
       }
+      m = tile_mask + offset + u * TILE_IMAGE_WIDTH * 2;
+      for(v = 0; v < TILE_SIZE * 2; v++)
+         q[v] = (q[v] & ~m[v]) | (p[v] & m[v]);
    }
+}
+
+/* Hash a 64bit counter, using the SplitMix64 finalizer.  This is used as
+   a counter-based PRNG for tile variations: variation bits for each cell
+   depend only on seed and cell position, so rows can be processed in any
+   order, and variations for a given seed don't depend on libc's rand(). */
+static uint64_t CounterHash(uint64_t counter)
+{
+   counter += 0x9e3779b97f4a7c15ull;
+   counter = (counter ^ (counter >> 30)) * 0xbf58476d1ce4e5b9ull;
+   counter = (counter ^ (counter >> 27)) * 0x94d049bb133111ebull;
+   return counter ^ (counter >> 31);
+}
+
+/* Table for spreading 8 bits into 8 bytes: byte i of spread_bits[b] is
+   bit i of b.                                                         */
+static uint64_t spread_bits[256];
+
+/* Initialize spread_bits. */
+static void InitSpreadBits()
+{
+   int b, i;
+
+   for(b = 0; b < 256; b++)
+   {
+      spread_bits[b] = 0;
+      for(i = 0; i < 8; i++)
+         spread_bits[b] |= (uint64_t)((b >> i) & 1) << (i * 8);
+   }
+}
 
-   /* Fill all empty spots that are not accessible. */
-   p = accessible_spots;
-   for(y = 0; y < MAP_HEIGHT; y++)
+/* Compute tile indices for one row of cells.  "tiles" must have room for
+   BITBOARD_WORDS * 64 entries, entries beyond map_width are garbage.
+
+   Neighbor bits are computed 64 cells at a time by shifting bitboard
+   words, with bit layout described in generate_wall_tiles.c.  Padding
+   bits in the bitboard are walls, so cells outside the map are walls
+   without any bounds checking.  The neighbor words are then expanded 8
+   cells at a time into 8 tile indices packed in a 64bit word, and cells
+   that are walls are replaced with WALL_TILE_INDEX using a byte mask.
+   Variation bits for the same 8 cells come from a single hash.          */
+static void GetTileRow(const uint64_t *walls, uint64_t seed, int y,
+                       uint8_t *tiles)
+{
+   const uint64_t *row = BITBOARD_ROW(walls, y);
+   const uint64_t *up_row = BITBOARD_ROW(walls, y - 1);
+   const uint64_t *down_row = BITBOARD_ROW(walls, y + 1);
+   const uint64_t counter_base = (seed << 32) ^ ((uint64_t)y << 11);
+   const uint64_t variation_mask = VARIATION_MASK * 0x0101010101010101ull;
+   const uint64_t wall_tile = WALL_TILE_INDEX * 0x0101010101010101ull;
+   uint64_t wall, right, down, left, up, index, mask;
+   int w, shift, i;
+
+   for(w = 0; w < BITBOARD_WORDS; w++)
    {
-      for(x = 0; x < MAP_WIDTH; x++, p++)
+      wall = row[w];
+      right = (row[w] >> 1) | (row[w + 1] << 63);
+      down = down_row[w];
+      left = (row[w] << 1) | (row[w - 1] >> 63);
+      up = up_row[w];
+      for(shift = 0; shift < 64; shift += 8, tiles += 8)
       {
-         if( map_data[y][x] == 0 && *p == 0 )
-            map_data[y][x] = 1;
+         index = spread_bits[(right >> shift) & 0xff] |
+                 (spread_bits[(down >> shift) & 0xff] << 1) |
+                 (spread_bits[(left >> shift) & 0xff] << 2) |
+                 (spread_bits[(up >> shift) & 0xff] << 3) |
+                 (CounterHash(counter_base + w * 8 + shift / 8) &
+                  variation_mask);
+         mask = spread_bits[(wall >> shift) & 0xff] * 0xff;
+         index = (index & ~mask) | (wall_tile & mask);
+         for(i = 0; i < 8; i++)
+            tiles[i] = (uint8_t)(index >> (i * 8));
       }
    }
+}
+
+/* Map generation phases, in the order they are run. */
+typedef enum
+{
+   PHASE_RANDOM_FILL,
+   PHASE_SMOOTH,
+   PHASE_ERODE,
+   PHASE_FLOOD_FILL,
+   PHASE_BRUSH,
+   PHASE_SEAL,
+   PHASE_EMIT_TILES,
+   PHASE_DONE
+} GeneratorPhase;
+
+/* Phase names for "--phase-times". */
+static const char *kPhaseNames[PHASE_DONE] =
+{
+   "random_fill",
+   "smooth",
+   "erode",
+   "flood_fill",
+   "brush",
+   "seal",
+   "emit_tiles",
+};
+
+/* Number of smoothing iterations. */
+#define SMOOTH_ITERATIONS  4
+
+/* Maximum number of spans to pop per unit of flood fill work.  This is
+   roughly the cost of processing one row in the other phases.          */
+#define FLOOD_FILL_SPANS_PER_UNIT  64
+
+/* Number of bitboards used during map generation. */
+#define GENERATOR_BITBOARD_COUNT  5
+
+/* Bytes per row in generated tile indices. */
+#define TILE_ROW_STRIDE  (BITBOARD_WORDS * 64)
+
+/* Resumable map generator.
+
+   Map generation is split into small units of work, most of which process
+   a single row of cells, so that StepMapGenerator can stop after any unit
+   and resume later.  This is the same idea as init_world in main.lua,
+   which yields after each small step so that async_init_world can run it
+   using spare cycles at the end of each frame.  Output is identical
+   regardless of how the work is sliced.
+
+   Note that the random fill phase uses rand(), so only one generator
+   should be running at a time.                                           */
+typedef struct
+{
+   GeneratorPhase phase;
+
+   /* Next row to process in current phase, and current smoothing
+      iteration.                                                  */
+   int y, iteration;
+
+   /* All bitboards are allocated in a single buffer.  The two smoothing
+      bitboards have all padding bits set, and the others have padding
+      bits cleared.  "walls" is whichever smoothing bitboard holds the
+      smoothed map.                                                      */
+   uint64_t *buffer;
+   uint64_t *current, *next;
+   uint64_t *walls, *open, *visited, *accessible;
+
+   /* Flood fill stack. */
+   Span *stack;
+   int stack_size, stack_capacity;
+
+   /* Generated tile indices, TILE_ROW_STRIDE bytes per row. */
+   uint8_t *tiles;
+
+   /* Seed for tile variations. */
+   uint64_t seed;
+
+   /* If set, time spent in each phase is accumulated in phase_ns. */
+   int time_phases;
+   int64_t phase_ns[PHASE_DONE];
+} MapGenerator;
+
+/* Allocate generator resources. */
+static void InitMapGenerator(MapGenerator *gen, unsigned int seed)
+{
+   memset(gen, 0, sizeof(MapGenerator));
+   gen->stack_capacity = map_width + map_height;
+   gen->stack = (Span*)malloc(gen->stack_capacity * sizeof(Span));
+   gen->buffer = (uint64_t*)calloc(
+      (size_t)BITBOARD_SIZE * GENERATOR_BITBOARD_COUNT, sizeof(uint64_t));
+   gen->tiles = (uint8_t*)malloc((size_t)TILE_ROW_STRIDE * map_height);
+   if( gen->stack == NULL || gen->buffer == NULL || gen->tiles == NULL )
+   {
+      puts("Out of memory");
+      exit(EXIT_FAILURE);
+   }
+
+   gen->current = gen->buffer;
+   gen->next = gen->buffer + BITBOARD_SIZE;
+   gen->open = gen->buffer + BITBOARD_SIZE * 2;
+   gen->visited = gen->buffer + BITBOARD_SIZE * 3;
+   gen->accessible = gen->buffer + BITBOARD_SIZE * 4;
+   memset(gen->buffer, 0xff, BITBOARD_SIZE * 2 * sizeof(uint64_t));
 
-   free(accessible_spots);
+   gen->seed = seed;
+   srand(seed);
+   InitSpreadBits();
 }
 
-/* Populate map_data with generated map data. */
-static void GenerateMapCells()
+/* Release generator resources. */
+static void FreeMapGenerator(MapGenerator *gen)
 {
-   GenerateRandomMapCells();
-   SmoothMapCells();
-   FillMapHoles();
+   free(gen->stack);
+   free(gen->buffer);
+   free(gen->tiles);
+   memset(gen, 0, sizeof(MapGenerator));
 }
 
-/* Write tile to specified position in output_pixels. */
-static void WriteTile(int tile_index, int x, int y)
+/* Pop up to FLOOD_FILL_SPANS_PER_UNIT spans from the flood fill stack,
+   pushing all new spans that are reachable from them.  Cells are marked
+   as visited when their spans are pushed, so no cell is pushed twice.   */
+static void FloodFillUnit(MapGenerator *gen)
 {
-   png_bytep p, q;
-   const int ty = (tile_index >> 4) * TILE_SIZE;
-   const int tx = (tile_index & 15) * TILE_SIZE;
-   int u, v;
+   Span s;
+   int i, x, x_end, y;
 
-   for(u = 0; u < TILE_SIZE; u++)
+   for(i = 0; i < FLOOD_FILL_SPANS_PER_UNIT && gen->stack_size > 0; i++)
    {
-      p = tile_pixels + ((ty + u) * TILE_IMAGE_WIDTH + tx) * 2;
-      q = output_pixels + ((y + u) * IMAGE_WIDTH + x) * 2;
-      for(v = 0; v < TILE_SIZE; v++, p += 2, q += 2)
+      s = gen->stack[--gen->stack_size];
+      for(y = s.y - 1; y <= s.y + 1; y += 2)
       {
-         if( p[1] != 0 )
+         if( y < 0 || y >= map_height )
+            continue;
+         x_end = s.x1 + 1 < map_width ? s.x1 + 1 : map_width - 1;
+         for(x = FindNextBit(gen->open, gen->visited,
+                             s.x0 > 0 ? s.x0 - 1 : 0, x_end, y);
+             x <= x_end;
+             x = FindNextBit(gen->open, gen->visited, x, x_end, y))
          {
-            q[0] = p[0];
-            q[1] = p[1];
+            if( gen->stack_size == gen->stack_capacity )
+               gen->stack = GrowStack(gen->stack, &gen->stack_capacity);
+            PushSpan(gen->open, gen->visited, x, y,
+                     gen->stack, &gen->stack_size);
+            x = gen->stack[gen->stack_size - 1].x1 + 1;
+            if( x > x_end )
+               break;
          }
       }
    }
 }
 
-/* Convert map_data into pixel data and write them to output_pixels. */
-static void GenerateMapPixels()
+/* Run a single unit of work.  Returns 1 if there is more work to do. */
+static int RunGeneratorUnit(MapGenerator *gen)
 {
-   int x, y, tile_index;
+   uint64_t *t;
 
-   for(y = 0; y < MAP_HEIGHT; y++)
+   switch( gen->phase )
    {
-      for(x = 0; x < MAP_WIDTH; x++)
-      {
-         if( map_data[y][x] )
+      case PHASE_RANDOM_FILL:
+         RandomFillRow(gen->current, gen->y);
+         break;
+
+      case PHASE_SMOOTH:
+         SmoothRow(gen->current, gen->next, gen->y);
+         if( gen->y < map_height - 1 )
+            break;
+
+         /* Swap buffers for next iteration. */
+         t = gen->current;
+         gen->current = gen->next;
+         gen->next = t;
+         if( ++gen->iteration < SMOOTH_ITERATIONS )
          {
-            tile_index = WALL_TILE_INDEX;
+            gen->y = 0;
+            return 1;
          }
-         else
+         gen->walls = gen->current;
+         CarveCenter(gen->walls);
+         break;
+
+      case PHASE_ERODE:
+         ErodeRow(gen->walls, gen->open, gen->y);
+         if( gen->y == map_height - 1 )
          {
-            tile_index = (MAP_DATA(x + 1, y    ) << 0) |
-                         (MAP_DATA(x,     y + 1) << 1) |
-                         (MAP_DATA(x - 1, y    ) << 2) |
-                         (MAP_DATA(x,     y - 1) << 3) |
-                         (rand() & VARIATION_MASK);
+            PushSpan(gen->open, gen->visited, map_width / 2, map_height / 2,
+                     gen->stack, &gen->stack_size);
          }
-         WriteTile(tile_index, x * TILE_SIZE, y * TILE_SIZE);
+         break;
+
+      case PHASE_FLOOD_FILL:
+         FloodFillUnit(gen);
+         if( gen->stack_size > 0 )
+            return 1;
+         gen->phase++;
+         return 1;
+
+      case PHASE_BRUSH:
+         BrushRow(gen->walls, gen->visited, gen->accessible, gen->y);
+         break;
+
+      case PHASE_SEAL:
+         SealRow(gen->walls, gen->accessible, gen->y);
+         break;
+
+      case PHASE_EMIT_TILES:
+         GetTileRow(gen->walls, gen->seed, gen->y,
+                    gen->tiles + (size_t)gen->y * TILE_ROW_STRIDE);
+         break;
+
+      case PHASE_DONE:
+         return 0;
+   }
+
+   /* Advance to next row, or to the next phase after the last row. */
+   if( ++gen->y == map_height )
+   {
+      gen->y = 0;
+      gen->phase++;
+   }
+   return gen->phase != PHASE_DONE;
+}
+
+/* Get elapsed time in nanoseconds. */
+static int64_t ElapsedNanoseconds(const struct timespec *start)
+{
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (int64_t)(now.tv_sec - start->tv_sec) * 1000000000 +
+          (now.tv_nsec - start->tv_nsec);
+}
+
+/* Run map generator for approximately "budget_us" microseconds, or until
+   completion if budget_us is negative.  Similar to async_init_world,
+   this always runs at least one unit of work, and stops after the first
+   unit that goes over budget.  Returns 1 when map generation is done.   */
+static int StepMapGenerator(MapGenerator *gen, long budget_us)
+{
+   struct timespec start, unit_start;
+   GeneratorPhase phase;
+   int more;
+
+   clock_gettime(CLOCK_MONOTONIC, &start);
+   for(;;)
+   {
+      phase = gen->phase;
+      if( gen->time_phases )
+         clock_gettime(CLOCK_MONOTONIC, &unit_start);
+      more = RunGeneratorUnit(gen);
+      if( gen->time_phases && phase != PHASE_DONE )
+         gen->phase_ns[phase] += ElapsedNanoseconds(&unit_start);
+      if( !more )
+         return 1;
+
+      if( budget_us >= 0 &&
+          ElapsedNanoseconds(&start) >= (int64_t)budget_us * 1000 )
+         return 0;
+   }
+}
+
+/* Convert tile indices into pixel data and write one row of tiles at a
+   time.  "band" holds TILE_SIZE scanlines of output.  Returns 1 on
+   success.                                                             */
+static int WriteMapPixels(ImageWriter *writer, uint8_t *band,
+                          const uint8_t *tiles)
+{
+   const size_t band_row_size = (size_t)map_width * TILE_SIZE * 2;
+   int x, y;
+
+   for(y = 0; y < map_height; y++, tiles += TILE_ROW_STRIDE)
+   {
+      /* Initialize row to be all opaque white pixels.  Wall tiles (with
+         transparent bits) will be drawn on top of this.                 */
+      memset(band, 0xff, band_row_size * TILE_SIZE);
+
+      for(x = 0; x < map_width; x++)
+         WriteTile(band, tiles[x], x * TILE_SIZE);
+
+      for(x = 0; x < TILE_SIZE; x++)
+      {
+         if( !WriteImageRow(writer, band + x * band_row_size) )
+            return 0;
       }
    }
+   return 1;
 }
 
 int main(int argc, char **argv)
 {
-   png_image tiles_image, output_image;
-
-   if( argc != 3 )
-      return printf("%s {input-tile-table.png} {output.png}\n", *argv);
+   ImageReader reader;
+   ImageWriter writer;
+   MapGenerator gen;
+   struct timespec slice_start;
+   uint8_t *band;
+   unsigned int seed;
+   long budget_us = -1;
+   int64_t slice_ns, worst_slice_ns, total_ns;
+   int arg, y, slice_count, done, time_phases;
+
+   seed = (unsigned int)time(NULL);
+   time_phases = 0;
+   for(arg = 1; arg + 2 < argc; arg += 2)
+   {
+      if( strcmp(argv[arg], "--phase-times") == 0 )
+      {
+         time_phases = 1;
+         arg--;
+      }
+      else if( strcmp(argv[arg], "--width") == 0 )
+         map_width = atoi(argv[arg + 1]);
+      else if( strcmp(argv[arg], "--height") == 0 )
+         map_height = atoi(argv[arg + 1]);
+      else if( strcmp(argv[arg], "--seed") == 0 )
+         seed = (unsigned int)strtoul(argv[arg + 1], NULL, 10);
+      else if( strcmp(argv[arg], "--budget") == 0 )
+         budget_us = atol(argv[arg + 1]);
+      else
+         break;
+   }
+   if( arg + 2 != argc )
+   {
+      return printf("%s [--width {w}] [--height {h}] [--seed {seed}] "
+                    "[--budget {us}] [--phase-times] "
+                    "{input-tile-table.png} {output.png}\n", *argv);
+   }
+   if( budget_us < -1 )
+   {
+      printf("Invalid budget: %ld\n", budget_us);
+      return 1;
+   }
+   if( map_width < 3 || map_width > MAX_MAP_SIZE ||
+       map_height < 3 || map_height > MAX_MAP_SIZE )
+   {
+      printf("Invalid map size: %d,%d\n", map_width, map_height);
+      return 1;
+   }
 
-   if( strcmp(argv[2], "-") == 0 && isatty(STDOUT_FILENO) )
+   if( strcmp(argv[arg + 1], "-") == 0 && isatty(STDOUT_FILENO) )
    {
       fputs("Not writing output to stdout because it's a tty\n", stderr);
       return 1;
@@ -366,58 +843,84 @@ int main(int argc, char **argv)
       setmode(STDOUT_FILENO, O_BINARY);
    #endif
 
-   srand(time(NULL));
-
    /* Load tile image. */
-   memset(&tiles_image, 0, sizeof(tiles_image));
-   tiles_image.version = PNG_IMAGE_VERSION;
-   if( !png_image_begin_read_from_file(&tiles_image, argv[1]) )
-      return printf("Error reading %s\n", argv[1]);
-   tiles_image.format = PNG_FORMAT_GA;
-   if( tiles_image.width != TILE_IMAGE_WIDTH ||
-       tiles_image.height != TILE_IMAGE_HEIGHT )
+   if( !OpenImageReader(&reader, argv[arg]) )
+      return printf("Error reading %s\n", argv[arg]);
+   if( reader.width != TILE_IMAGE_WIDTH || reader.height != TILE_IMAGE_HEIGHT )
    {
       printf("Unexpected tile image size: expected %d,%d, got %d,%d\n",
-             TILE_IMAGE_WIDTH, TILE_IMAGE_HEIGHT,
-             (int)tiles_image.width, (int)tiles_image.height);
+             TILE_IMAGE_WIDTH, TILE_IMAGE_HEIGHT, reader.width, reader.height);
+      CloseImageReader(&reader);
       return 1;
    }
-   if( !png_image_finish_read(&tiles_image, NULL, tile_pixels, 0, NULL) )
-      return printf("Error loading %s\n", argv[1]);
-
-   /* Create map image. */
-   memset(&output_image, 0, sizeof(output_image));
-   output_image.version = PNG_IMAGE_VERSION;
-   output_image.format = PNG_FORMAT_GA;
-   output_image.width = IMAGE_WIDTH;
-   output_image.height = IMAGE_HEIGHT;
-
-   /* Initialize output image to be all opaque white pixels.
-      Wall tiles (with transparent bits) will be drawn on top of this. */
-   memset(output_pixels, 0xff, IMAGE_WIDTH * IMAGE_HEIGHT * 2);
-
-   /* Generate map. */
-   GenerateMapCells();
-   GenerateMapPixels();
+   for(y = 0; y < TILE_IMAGE_HEIGHT; y++)
+   {
+      if( !ReadImageRow(&reader, tile_pixels + y * TILE_IMAGE_WIDTH * 2) )
+      {
+         CloseImageReader(&reader);
+         return printf("Error loading %s\n", argv[arg]);
+      }
+   }
+   CloseImageReader(&reader);
+   ClassifyTiles();
+
+   /* Generate map.  If a budget is specified, generation is done in
+      slices of approximately that size, and we report the slice times
+      so that we can see how much latency each slice would add to a
+      frame.                                                           */
+   InitMapGenerator(&gen, seed);
+   gen.time_phases = time_phases;
+   slice_count = 0;
+   worst_slice_ns = total_ns = 0;
+   do
+   {
+      clock_gettime(CLOCK_MONOTONIC, &slice_start);
+      done = StepMapGenerator(&gen, budget_us);
+      slice_ns = ElapsedNanoseconds(&slice_start);
+      slice_count++;
+      total_ns += slice_ns;
+      if( worst_slice_ns < slice_ns )
+         worst_slice_ns = slice_ns;
+   } while( !done );
+   if( budget_us >= 0 )
+   {
+      fprintf(stderr,
+              "Generated map in %d slice(s): total %.1fus, "
+              "average %.1fus, worst %.1fus\n",
+              slice_count, total_ns / 1e3,
+              total_ns / 1e3 / slice_count, worst_slice_ns / 1e3);
+   }
 
    /* Write output. */
-   if( strcmp(argv[2], "-") == 0 )
+   band = (uint8_t*)malloc((size_t)map_width * TILE_SIZE * TILE_SIZE * 2);
+   if( band == NULL )
+      return puts("Out of memory");
+   clock_gettime(CLOCK_MONOTONIC, &slice_start);
+   if( !OpenImageWriter(&writer, argv[arg + 1],
+                        map_width * TILE_SIZE, map_height * TILE_SIZE) ||
+       !WriteMapPixels(&writer, band, gen.tiles) ||
+       !CloseImageWriter(&writer) )
    {
-      if( !png_image_write_to_stdio(
-             &output_image, stdout, 0, output_pixels, 0, NULL) )
-      {
+      CloseImageWriter(&writer);
+      if( strcmp(argv[arg + 1], "-") == 0 )
          fputs("Error writing to stdout\n", stderr);
-         return 1;
-      }
+      else
+         printf("Error writing %s\n", argv[arg + 1]);
+      free(band);
+      FreeMapGenerator(&gen);
+      return 1;
    }
-   else
+   slice_ns = ElapsedNanoseconds(&slice_start);
+   if( time_phases )
    {
-      if( !png_image_write_to_file(
-             &output_image, argv[2], 0, output_pixels, 0, NULL) )
+      for(y = 0; y < PHASE_DONE; y++)
       {
-         printf("Error writing %s\n", argv[2]);
-         return 1;
+         fprintf(stderr, "phase %s %.1f\n",
+                 kPhaseNames[y], gen.phase_ns[y] / 1e3);
       }
+      fprintf(stderr, "phase write_pixels %.1f\n", slice_ns / 1e3);
    }
+   free(band);
+   FreeMapGenerator(&gen);
    return 0;
 }
@@ -4,7 +4,9 @@
 
       ./generate_wall_tiles {output.png}
 
-   Use "-" to write output to stdout.
+   Use "-" to write output to stdout.  If output filename ends with
+   ".pbm", tiles are written as a 1bit bitmap instead, with black pixels
+   where tiles are opaque.
 
    Output tiles 0x00..0x0f are indexed by 4 bits:
 
@@ -29,242 +31,112 @@
    actually did try to check the 4 diagonal neighbors and adjust the output
    tile accordingly, but there just isn't enough detail in 8x8 tiles to
    make those variations worthwhile.
+
+   Tile shapes are defined in wall_tile_shapes.h.
 */
 
 #include<png.h>
+#include<stdint.h>
 #include<stdio.h>
 #include<stdlib.h>
 #include<string.h>
 #include<unistd.h>
+#include"wall_tile_shapes.h"
 
 #ifdef _WIN32
    #include<fcntl.h>
    #include<io.h>
 #endif
 
-/* Tile size in pixels. */
-#define TILE_SIZE     8
+/* Number of tiles per row of output. */
+#define TILES_PER_ROW  16
 
 /* Output tile table image size in pixels. */
-#define IMAGE_WIDTH   (TILE_SIZE * 16)
-#define IMAGE_HEIGHT  (TILE_SIZE * 9)
+#define IMAGE_WIDTH   (WALL_TILE_SIZE * TILES_PER_ROW)
+#define IMAGE_HEIGHT  \
+   (WALL_TILE_SIZE * ((WALL_TILE_COUNT + TILES_PER_ROW - 1) / TILES_PER_ROW))
+
+/* GA8 pixels for each possible tile row, indexed by WallTileRow value.
+   Color part of each pixel is always black, so only alpha bytes vary.  */
+static png_byte row_pixels[256][WALL_TILE_SIZE * 2];
 
-/* Draw solid black pixels onto a rectangular area. */
-static void Rect(png_bytep pixels, int x, int y, int w, int h)
+/* Build row_pixels table. */
+static void InitRowPixels()
 {
-   int ix, iy;
-   png_bytep p;
+   int bits, x;
 
-   for(iy = 0; iy < h; iy++)
+   for(bits = 0; bits < 256; bits++)
    {
-      /* The color part of each pixel is already black, so we only need to
-         set the alpha of each pixel to maximum opacity.  Here we set the
-         pointer to point at the first alpha byte in each scanline.        */
-      p = pixels + ((y + iy) * IMAGE_WIDTH + x) * 2 + 1;
-      for(ix = 0; ix < w; ix++, p += 2)
-         *p = 0xff;
+      for(x = 0; x < WALL_TILE_SIZE; x++)
+      {
+         row_pixels[bits][x * 2 + 1] =
+            (bits & (0x80 >> x)) != 0 ? 0xff : 0;
+      }
    }
 }
 
-/* Add tiles following indexing scheme described at the top of this file. */
-static void AddWallAdjacentTiles(png_bytep pixels)
+/* Get tile index for a tile position in output image, or -1 for unused
+   positions.                                                          */
+static int TileIndex(int tx, int ty)
 {
-   int tx, ty, x, y;
+   const int index = ty * TILES_PER_ROW + tx;
+   return index < WALL_TILE_COUNT ? index : -1;
+}
+
+/* Draw all tiles, writing one tile row at a time. */
+static void DrawTiles(png_bytep pixels)
+{
+   int tx, ty, y;
+   uint64_t bits;
 
-   for(ty = 0; ty < 8; ty++)
+   for(ty = 0; ty < IMAGE_HEIGHT / WALL_TILE_SIZE; ty++)
    {
-      y = ty * TILE_SIZE;
-      for(tx = 0; tx < 16; tx++)
+      for(tx = 0; tx < TILES_PER_ROW; tx++)
       {
-         x = tx * TILE_SIZE;
-         if( (tx & 1) != 0 )
-         {
-            /* Right.
-               0    1    2    3    4    5    6    7
-               ..   .#   ..   .#   .#   .#   .#   .#
-               .#   .#   .#   .#   .#   .#   .#   .#
-               .#   .#   .#   .#   .#   ##   .#   ##
-               ..   ..   ..   ..   ##   ##   ##   ##
-               ..   ..   ..   ..   ##   ##   ##   ##
-               .#   .#   .#   .#   .#   .#   ##   ##
-               .#   .#   .#   .#   .#   .#   .#   .#
-               ..   ..   .#   .#   .#   .#   .#   .#  */
-            if( (ty & 1) == 0 )
-            {
-               Rect(pixels, x + TILE_SIZE - 1, y + 1, 1, 2);
-               Rect(pixels, x + TILE_SIZE - 1, y + TILE_SIZE - 3, 1, 2);
-               if( (ty & 2) != 0 )
-                  Rect(pixels, x + TILE_SIZE - 1, y, 1, 1);
-               if( (ty & 4) != 0 )
-                  Rect(pixels, x + TILE_SIZE - 1, y + TILE_SIZE - 1, 1, 1);
-            }
-            else
-            {
-               Rect(pixels, x + TILE_SIZE - 1, y, 1, TILE_SIZE);
-               Rect(pixels, x + TILE_SIZE - 2, y + 3, 1, TILE_SIZE - 6);
-               if( (ty & 2) != 0 )
-                  Rect(pixels, x + TILE_SIZE - 2, y + 2, 1, 1);
-               if( (ty & 4) != 0 )
-                  Rect(pixels, x + TILE_SIZE - 2, y + TILE_SIZE - 3, 1, 1);
-            }
-         }
-         if( (tx & 2) != 0 )
-         {
-            /* Down.
-               0          1          2          3
-               ........   ........   ........   ........
-               .##..##.   .##..###   ###..##.   ###..###
-
-               4          5          6          7
-               ...##...   ...###..   ..###...   ..####..
-               ########   ########   ########   ########  */
-            if( (ty & 1) == 0 )
-            {
-               Rect(pixels, x + 1, y + TILE_SIZE - 1, 2, 1);
-               Rect(pixels, x + TILE_SIZE - 3, y + TILE_SIZE - 1, 2, 1);
-               if( (ty & 2) != 0 )
-                  Rect(pixels, x + TILE_SIZE - 1, y + TILE_SIZE - 1, 1, 1);
-               if( (ty & 4) != 0 )
-                  Rect(pixels, x, y + TILE_SIZE - 1, 1, 1);
-            }
-            else
-            {
-               Rect(pixels, x, y + TILE_SIZE - 1, TILE_SIZE, 1);
-               Rect(pixels, x + 3, y + TILE_SIZE - 2, TILE_SIZE - 6, 1);
-               if( (ty & 2) != 0 )
-                  Rect(pixels, x + TILE_SIZE - 3, y + TILE_SIZE - 2, 1, 1);
-               if( (ty & 4) != 0 )
-                  Rect(pixels, x + 2, y + TILE_SIZE - 2, 1, 1);
-            }
-         }
-         if( (tx & 4) != 0 )
-         {
-            /* Left.
-               0    1    2    3    4    5    6    7
-               ..   ..   #.   #.   #.   #.   #.   #.
-               #.   #.   #.   #.   #.   #.   #.   #.
-               #.   #.   #.   #.   #.   #.   ##   ##
-               ..   ..   ..   ..   ##   ##   ##   ##
-               ..   ..   ..   ..   ##   ##   ##   ##
-               #.   #.   #.   #.   #.   ##   #.   ##
-               #.   #.   #.   #.   #.   #.   #.   #.
-               ..   #.   ..   #.   #.   #.   #.   #.  */
-            if( (ty & 1) == 0 )
-            {
-               Rect(pixels, x, y + 1, 1, 2);
-               Rect(pixels, x, y + TILE_SIZE - 3, 1, 2);
-               if( (ty & 2) != 0 )
-                  Rect(pixels, x, y + TILE_SIZE - 1, 1, 1);
-               if( (ty & 4) != 0 )
-                  Rect(pixels, x, y, 1, 1);
-            }
-            else
-            {
-               Rect(pixels, x, y, 1, TILE_SIZE);
-               Rect(pixels, x + 1, y + 3, 1, TILE_SIZE - 6);
-               if( (ty & 2) != 0 )
-                  Rect(pixels, x + 1, y + TILE_SIZE - 3, 1, 1);
-               if( (ty & 4) != 0 )
-                  Rect(pixels, x + 1, y + 2, 1, 1);
-            }
-         }
-         if( (tx & 8) != 0 )
-         {
-            /* Up.
-               0          1          2          3
-               .##..##.   ###..##.   .##..###   ###..###
-               ........   ........   ........   ........
-
-               4          5          6          7
-               ########   ########   ########   ########
-               ...##...   ..###...   ...###..   ..####..  */
-            if( (ty & 1) == 0 )
-            {
-               Rect(pixels, x + 1, y, 2, 1);
-               Rect(pixels, x + TILE_SIZE - 3, y, 2, 1);
-               if( (ty & 2) != 0 )
-                  Rect(pixels, x, y, 1, 1);
-               if( (ty & 4) != 0 )
-                  Rect(pixels, x + TILE_SIZE - 1, y, 1, 1);
-            }
-            else
-            {
-               Rect(pixels, x, y, TILE_SIZE, 1);
-               Rect(pixels, x + 3, y + 1, TILE_SIZE - 6, 1);
-               if( (ty & 2) != 0 )
-                  Rect(pixels, x + 2, y + 1, 1, 1);
-               if( (ty & 4) != 0 )
-                  Rect(pixels, x + TILE_SIZE - 3, y + 1, 1, 1);
-            }
-         }
-
-         if( (tx & 3) == 3 )
-         {
-            /* Down right. */
-            Rect(pixels, x + TILE_SIZE - 1, y + TILE_SIZE - 5, 1, 1);
-            Rect(pixels, x + TILE_SIZE - 2, y + TILE_SIZE - 4, 2, 1);
-            Rect(pixels, x + TILE_SIZE - 3, y + TILE_SIZE - 3, 3, 1);
-            Rect(pixels, x + TILE_SIZE - 4, y + TILE_SIZE - 2, 4, 1);
-            Rect(pixels, x + TILE_SIZE - 5, y + TILE_SIZE - 1, 5, 1);
-         }
-         if( (tx & 6) == 6 )
-         {
-            /* Down left. */
-            Rect(pixels, x, y + TILE_SIZE - 5, 1, 1);
-            Rect(pixels, x, y + TILE_SIZE - 4, 2, 1);
-            Rect(pixels, x, y + TILE_SIZE - 3, 3, 1);
-            Rect(pixels, x, y + TILE_SIZE - 2, 4, 1);
-            Rect(pixels, x, y + TILE_SIZE - 1, 5, 1);
-         }
-         if( (tx & 12) == 12 )
-         {
-            /* Up left. */
-            Rect(pixels, x, y + 4, 1, 1);
-            Rect(pixels, x, y + 3, 2, 1);
-            Rect(pixels, x, y + 2, 3, 1);
-            Rect(pixels, x, y + 1, 4, 1);
-            Rect(pixels, x, y,     5, 1);
-         }
-         if( (tx & 9) == 9 )
+         bits = WallTileBits(TileIndex(tx, ty));
+         for(y = 0; y < WALL_TILE_SIZE; y++)
          {
-            /* Up right. */
-            Rect(pixels, x + TILE_SIZE - 1, y + 4, 1, 1);
-            Rect(pixels, x + TILE_SIZE - 2, y + 3, 2, 1);
-            Rect(pixels, x + TILE_SIZE - 3, y + 2, 3, 1);
-            Rect(pixels, x + TILE_SIZE - 4, y + 1, 4, 1);
-            Rect(pixels, x + TILE_SIZE - 5, y,     5, 1);
+            memcpy(pixels + (((ty * WALL_TILE_SIZE + y) * IMAGE_WIDTH) +
+                             tx * WALL_TILE_SIZE) * 2,
+                   row_pixels[WallTileRow(bits, y)],
+                   WALL_TILE_SIZE * 2);
          }
       }
    }
 }
 
-/* Add solid black rectangle, for use where current cell is a wall. */
-static void AddSolidWallTile(png_bytep pixels)
+/* Check if output filename ends with ".pbm". */
+static int IsBitmapOutput(const char *filename)
 {
-   Rect(pixels, 0, IMAGE_HEIGHT - TILE_SIZE, TILE_SIZE, TILE_SIZE);
+   const size_t length = strlen(filename);
+   return length > 4 && strcmp(filename + length - 4, ".pbm") == 0;
 }
 
-/* Add special debugging tiles, used for checking tile alignment.
-   These are never visible in release builds.                     */
-static void AddDebugTiles(png_bytep pixels)
+/* Write tiles as a 1bit PBM image, with black pixels where tiles are
+   opaque.  Returns 1 on success.                                     */
+static int WriteBitmap(const char *filename)
 {
-   int x, y;
-
-   /* Square with solid outline. */
-   Rect(pixels, TILE_SIZE, IMAGE_HEIGHT - TILE_SIZE, TILE_SIZE, 1);
-   Rect(pixels, TILE_SIZE, IMAGE_HEIGHT - 1, TILE_SIZE, 1);
-   Rect(pixels, TILE_SIZE, IMAGE_HEIGHT - TILE_SIZE, 1, TILE_SIZE);
-   Rect(pixels, TILE_SIZE * 2 - 1, IMAGE_HEIGHT - TILE_SIZE, 1, TILE_SIZE);
-
-   /* Square with dotted outline. */
-   for(y = 0; y < TILE_SIZE; y++)
+   png_byte row[IMAGE_WIDTH / 8];
+   FILE *outfile;
+   int tx, ty, y, ok;
+
+   if( (outfile = fopen(filename, "wb")) == NULL )
+      return 0;
+   ok = fprintf(outfile, "P4\n%d %d\n", IMAGE_WIDTH, IMAGE_HEIGHT) > 0;
+   for(ty = 0; ok && ty < IMAGE_HEIGHT / WALL_TILE_SIZE; ty++)
    {
-      for(x = y & 1; x < TILE_SIZE; x += 2)
+      for(y = 0; ok && y < WALL_TILE_SIZE; y++)
       {
-         if( x == 0 || y == 0 || x == TILE_SIZE - 1 || y == TILE_SIZE - 1 )
-            Rect(pixels, TILE_SIZE * 2 + x, IMAGE_HEIGHT - TILE_SIZE + y, 1, 1);
+         for(tx = 0; tx < TILES_PER_ROW; tx++)
+            row[tx] = WallTileRow(WallTileBits(TileIndex(tx, ty)), y);
+         ok = fwrite(row, sizeof(row), 1, outfile) == 1;
       }
    }
+   if( fclose(outfile) != 0 )
+      ok = 0;
+   if( !ok )
+      remove(filename);
+   return ok;
 }
 
 int main(int argc, char **argv)
@@ -283,6 +155,16 @@ int main(int argc, char **argv)
       setmode(STDOUT_FILENO, O_BINARY);
    #endif
 
+   if( IsBitmapOutput(argv[1]) )
+   {
+      if( !WriteBitmap(argv[1]) )
+      {
+         printf("Error writing %s\n", argv[1]);
+         return 1;
+      }
+      return 0;
+   }
+
    memset(&image, 0, sizeof(image));
    image.version = PNG_IMAGE_VERSION;
    image.format = PNG_FORMAT_GA;
@@ -296,9 +178,8 @@ int main(int argc, char **argv)
    }
 
    /* Draw tiles. */
-   AddWallAdjacentTiles(pixels);
-   AddSolidWallTile(pixels);
-   AddDebugTiles(pixels);
+   InitRowPixels();
+   DrawTiles(pixels);
 
    /* Write output.  Here we set the flags to optimize for encoding speed
       rather than output size so that we can iterate faster.  This is fine
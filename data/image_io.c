@@ -0,0 +1,585 @@
+/* Row-streaming image reader and writer.  See image_io.h for details. */
+
+#include"image_io.h"
+#include<setjmp.h>
+#include<stdint.h>
+#include<stdlib.h>
+#include<string.h>
+
+#ifndef _WIN32
+   #include<sys/mman.h>
+   #include<sys/stat.h>
+#endif
+
+/* Maximum width or height for raw images.  This keeps row sizes well
+   within int range, same as the PNG limits we get from libpng.       */
+#define MAX_RAW_IMAGE_SIZE  0x1000000
+
+/* libpng error callback.  We don't print anything here because every
+   tool prints its own error message when a call fails, same as what
+   the simplified API does.                                          */
+static void ErrorCallback(png_structp png, png_const_charp message)
+{
+   (void)message;
+   png_longjmp(png, 1);
+}
+
+/* libpng warning callback.  Warnings are dropped silently. */
+static void WarningCallback(png_structp png, png_const_charp message)
+{
+   (void)png;
+   (void)message;
+}
+
+/* Set up input transformations to produce 8bit gray+alpha, following
+   what png_image_read_direct does for PNG_FORMAT_GA.                 */
+static void SetReadTransforms(png_structp png, png_infop info)
+{
+   const int color_type = png_get_color_type(png, info);
+
+   /* Expand palettes and low bit depth grayscale to 8 bits, and convert
+      tRNS chunks to alpha channel.                                     */
+   png_set_expand(png);
+
+   /* Convert color to grayscale. */
+   if( (color_type & PNG_COLOR_MASK_COLOR) != 0 )
+   {
+      png_set_rgb_to_gray_fixed(png, PNG_ERROR_ACTION_NONE,
+                                PNG_RGB_TO_GRAY_DEFAULT,
+                                PNG_RGB_TO_GRAY_DEFAULT);
+   }
+
+   /* Set input gamma default, followed by output gamma.  Input without
+      gAMA chunk is assumed to be sRGB, except 16bit images are assumed
+      to be linear.                                                    */
+   png_set_alpha_mode_fixed(png, PNG_ALPHA_PNG,
+                            png_get_bit_depth(png, info) == 16
+                            ? PNG_GAMMA_LINEAR : PNG_DEFAULT_sRGB);
+   png_set_alpha_mode_fixed(png, PNG_ALPHA_PNG, PNG_DEFAULT_sRGB);
+
+   /* Reduce 16bit input to 8bit. */
+   if( png_get_bit_depth(png, info) == 16 )
+      png_set_scale_16(png);
+
+   /* Add opaque alpha channel if input doesn't have alpha. */
+   if( (color_type & PNG_COLOR_MASK_ALPHA) == 0 &&
+       !png_get_valid(png, info, PNG_INFO_tRNS) )
+   {
+      png_set_add_alpha(png, 0xff, PNG_FILLER_AFTER);
+   }
+}
+
+/* Decode a 32bit little endian integer. */
+static uint32_t GetUint32(const png_byte *p)
+{
+   return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+          ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* Encode a 32bit little endian integer. */
+static void PutUint32(png_bytep p, uint32_t v)
+{
+   p[0] = (png_byte)v;
+   p[1] = (png_byte)(v >> 8);
+   p[2] = (png_byte)(v >> 16);
+   p[3] = (png_byte)(v >> 24);
+}
+
+/* Finish opening raw input, after the 4 magic bytes have been read.
+   Returns 1 on success.                                             */
+static int OpenRawReader(ImageReader *reader)
+{
+   png_byte header[RAW_IMAGE_HEADER_SIZE - 4];
+   uint32_t format, width, height;
+
+   if( fread(header, sizeof(header), 1, reader->file) != 1 )
+      return 0;
+   format = GetUint32(header);
+   width = GetUint32(header + 4);
+   height = GetUint32(header + 8);
+   if( format != RAW_IMAGE_FORMAT_GA8 ||
+       width == 0 || width > MAX_RAW_IMAGE_SIZE ||
+       height == 0 || height > MAX_RAW_IMAGE_SIZE )
+   {
+      return 0;
+   }
+   reader->raw = 1;
+   reader->width = (int)width;
+   reader->height = (int)height;
+
+   /* Map input into memory if it's a regular file.  We check the stream
+      position to make sure that the header we just read is at the start
+      of the file.  If mapping fails for any reason, we fall back to
+      reading one row at a time.                                         */
+   #ifndef _WIN32
+   {
+      const size_t size = RAW_IMAGE_HEADER_SIZE +
+                          (size_t)width * height * IMAGE_PIXEL_SIZE;
+      const int fd = fileno(reader->file);
+      struct stat st;
+      void *map;
+
+      if( ftell(reader->file) == RAW_IMAGE_HEADER_SIZE &&
+          fstat(fd, &st) == 0 && S_ISREG(st.st_mode) )
+      {
+         if( (size_t)st.st_size < size )
+            return 0;
+         map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+         if( map != MAP_FAILED )
+         {
+            #ifdef MADV_SEQUENTIAL
+               madvise(map, size, MADV_SEQUENTIAL);
+            #endif
+            reader->raw_map = map;
+            reader->raw_map_size = size;
+            reader->raw_pixels = (png_const_bytep)map + RAW_IMAGE_HEADER_SIZE;
+         }
+      }
+   }
+   #endif
+   return 1;
+}
+
+int OpenImageReader(ImageReader *reader, const char *filename)
+{
+   int passes;
+   png_bytepp volatile rows = NULL;
+   png_uint_32 y;
+   png_byte signature[4];
+
+   memset(reader, 0, sizeof(ImageReader));
+   if( strcmp(filename, "-") == 0 )
+   {
+      reader->file = stdin;
+   }
+   else
+   {
+      reader->file = fopen(filename, "rb");
+      if( reader->file == NULL )
+         return 0;
+      reader->close_file = 1;
+   }
+
+   /* Check signature to see if input is raw or PNG. */
+   if( fread(signature, sizeof(signature), 1, reader->file) != 1 )
+   {
+      CloseImageReader(reader);
+      return 0;
+   }
+   if( memcmp(signature, RAW_IMAGE_MAGIC, sizeof(signature)) == 0 )
+   {
+      if( !OpenRawReader(reader) )
+      {
+         CloseImageReader(reader);
+         return 0;
+      }
+      return 1;
+   }
+   if( png_sig_cmp(signature, 0, sizeof(signature)) != 0 )
+   {
+      CloseImageReader(reader);
+      return 0;
+   }
+
+   reader->png = png_create_read_struct(
+      PNG_LIBPNG_VER_STRING, NULL, ErrorCallback, WarningCallback);
+   if( reader->png == NULL )
+   {
+      CloseImageReader(reader);
+      return 0;
+   }
+   reader->info = png_create_info_struct(reader->png);
+   if( reader->info == NULL )
+   {
+      CloseImageReader(reader);
+      return 0;
+   }
+   if( setjmp(png_jmpbuf(reader->png)) )
+   {
+      free(rows);
+      CloseImageReader(reader);
+      return 0;
+   }
+
+   png_set_benign_errors(reader->png, 1);
+   png_init_io(reader->png, reader->file);
+   png_set_sig_bytes(reader->png, sizeof(signature));
+   png_read_info(reader->png, reader->info);
+   SetReadTransforms(reader->png, reader->info);
+   passes = png_set_interlace_handling(reader->png);
+   png_read_update_info(reader->png, reader->info);
+
+   reader->width = (int)png_get_image_width(reader->png, reader->info);
+   reader->height = (int)png_get_image_height(reader->png, reader->info);
+   if( png_get_rowbytes(reader->png, reader->info) !=
+       (png_size_t)reader->width * IMAGE_PIXEL_SIZE )
+   {
+      CloseImageReader(reader);
+      return 0;
+   }
+
+   if( passes > 1 )
+   {
+      /* Decode full image up front for interlaced input. */
+      reader->full_image = (png_bytep)malloc(
+         (size_t)reader->width * reader->height * IMAGE_PIXEL_SIZE);
+      rows = (png_bytepp)malloc(reader->height * sizeof(png_bytep));
+      if( reader->full_image == NULL || rows == NULL )
+      {
+         free(rows);
+         CloseImageReader(reader);
+         return 0;
+      }
+      for(y = 0; y < (png_uint_32)reader->height; y++)
+      {
+         rows[y] = reader->full_image +
+                   (size_t)y * reader->width * IMAGE_PIXEL_SIZE;
+      }
+      png_read_image(reader->png, rows);
+      free(rows);
+   }
+   return 1;
+}
+
+int ReadImageRow(ImageReader *reader, png_bytep row)
+{
+   const size_t row_size = (size_t)reader->width * IMAGE_PIXEL_SIZE;
+
+   if( (reader->png == NULL && !reader->raw) ||
+       reader->current_row >= reader->height )
+   {
+      return 0;
+   }
+
+   if( reader->raw_pixels != NULL )
+   {
+      memcpy(row,
+             reader->raw_pixels + (size_t)reader->current_row * row_size,
+             row_size);
+   }
+   else if( reader->raw )
+   {
+      if( fread(row, row_size, 1, reader->file) != 1 )
+         return 0;
+   }
+   else if( reader->full_image != NULL )
+   {
+      memcpy(row,
+             reader->full_image +
+             (size_t)reader->current_row * reader->width * IMAGE_PIXEL_SIZE,
+             (size_t)reader->width * IMAGE_PIXEL_SIZE);
+   }
+   else
+   {
+      if( setjmp(png_jmpbuf(reader->png)) )
+         return 0;
+      png_read_row(reader->png, row, NULL);
+   }
+   reader->current_row++;
+   return 1;
+}
+
+png_const_bytep GetImageRow(ImageReader *reader)
+{
+   const size_t row_size = (size_t)reader->width * IMAGE_PIXEL_SIZE;
+   png_const_bytep row;
+
+   if( reader->current_row >= reader->height )
+      return NULL;
+
+   /* Return pointer into full image if we have one. */
+   if( reader->raw_pixels != NULL || reader->full_image != NULL )
+   {
+      row = (reader->raw_pixels != NULL ? reader->raw_pixels
+                                        : reader->full_image) +
+            (size_t)reader->current_row * row_size;
+      reader->current_row++;
+      return row;
+   }
+
+   /* Decode into reader's own buffer. */
+   if( reader->row_buffer == NULL )
+   {
+      reader->row_buffer = (png_bytep)malloc(row_size);
+      if( reader->row_buffer == NULL )
+         return NULL;
+   }
+   if( !ReadImageRow(reader, reader->row_buffer) )
+      return NULL;
+   return reader->row_buffer;
+}
+
+void CloseImageReader(ImageReader *reader)
+{
+   if( reader->png != NULL )
+   {
+      png_destroy_read_struct(&reader->png,
+                              reader->info == NULL ? NULL : &reader->info,
+                              NULL);
+   }
+   #ifndef _WIN32
+      if( reader->raw_map != NULL )
+         munmap(reader->raw_map, reader->raw_map_size);
+   #endif
+   if( reader->close_file )
+      fclose(reader->file);
+   free(reader->full_image);
+   free(reader->row_buffer);
+   memset(reader, 0, sizeof(ImageReader));
+}
+
+/* Common code for OpenImageWriter and OpenPackedImageWriter. */
+static int OpenWriter(ImageWriter *writer,
+                      const char *filename,
+                      int width,
+                      int height,
+                      int packed)
+{
+   static const png_color palette[3] =
+   {
+      {0, 0, 0}, {0, 0, 0}, {0xff, 0xff, 0xff}
+   };
+   static const png_byte palette_alpha[1] = {0};
+   const size_t name_size = strlen(filename);
+   const size_t suffix_size = strlen(RAW_IMAGE_SUFFIX);
+   png_byte header[RAW_IMAGE_HEADER_SIZE];
+
+   memset(writer, 0, sizeof(ImageWriter));
+   writer->width = width;
+   writer->height = height;
+   if( width <= 0 || height <= 0 )
+      return 0;
+   writer->raw = name_size > suffix_size &&
+                 strcmp(filename + name_size - suffix_size,
+                        RAW_IMAGE_SUFFIX) == 0;
+
+   if( strcmp(filename, "-") == 0 )
+   {
+      writer->file = stdout;
+   }
+   else
+   {
+      writer->file = fopen(filename, "wb");
+      if( writer->file == NULL )
+         return 0;
+      writer->filename = filename;
+   }
+   if( packed )
+   {
+      /* Raw packed writers need a full GA8 row for thresholded pixels. */
+      writer->packed_row = (png_bytep)malloc(
+         writer->raw ? (size_t)width * IMAGE_PIXEL_SIZE
+                     : (size_t)(width + 3) / 4);
+      if( writer->packed_row == NULL )
+      {
+         writer->failed = 1;
+         CloseImageWriter(writer);
+         return 0;
+      }
+   }
+
+   if( writer->raw )
+   {
+      memcpy(header, RAW_IMAGE_MAGIC, 4);
+      PutUint32(header + 4, RAW_IMAGE_FORMAT_GA8);
+      PutUint32(header + 8, (uint32_t)width);
+      PutUint32(header + 12, (uint32_t)height);
+      if( fwrite(header, sizeof(header), 1, writer->file) != 1 )
+      {
+         writer->failed = 1;
+         CloseImageWriter(writer);
+         return 0;
+      }
+      return 1;
+   }
+
+   writer->png = png_create_write_struct(
+      PNG_LIBPNG_VER_STRING, NULL, ErrorCallback, WarningCallback);
+   if( writer->png == NULL )
+   {
+      writer->failed = 1;
+      CloseImageWriter(writer);
+      return 0;
+   }
+   writer->info = png_create_info_struct(writer->png);
+   if( writer->info == NULL )
+   {
+      writer->failed = 1;
+      CloseImageWriter(writer);
+      return 0;
+   }
+   if( setjmp(png_jmpbuf(writer->png)) )
+   {
+      writer->failed = 1;
+      CloseImageWriter(writer);
+      return 0;
+   }
+
+   png_init_io(writer->png, writer->file);
+   if( packed )
+   {
+      /* 2bit palette, with index 0 being the only transparent entry. */
+      png_set_IHDR(writer->png, writer->info, width, height, 2,
+                   PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE,
+                   PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
+      png_set_PLTE(writer->png, writer->info, palette, 3);
+      png_set_tRNS(writer->png, writer->info, palette_alpha, 1, NULL);
+   }
+   else
+   {
+      png_set_IHDR(writer->png, writer->info, width, height, 8,
+                   PNG_COLOR_TYPE_GRAY_ALPHA, PNG_INTERLACE_NONE,
+                   PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
+   }
+   png_set_sRGB(writer->png, writer->info, PNG_sRGB_INTENT_PERCEPTUAL);
+
+   /* Optimize for encoding speed rather than output size, same as
+      PNG_IMAGE_FLAG_FAST.  This is fine since the output of these tools
+      are intermediate files that are used only in the build process, and
+      are not the final PNGs that will be committed.                      */
+   png_set_filter(writer->png, PNG_FILTER_TYPE_BASE, PNG_FILTER_NONE);
+   png_set_compression_level(writer->png, 3);
+
+   png_write_info(writer->png, writer->info);
+   return 1;
+}
+
+int OpenImageWriter(ImageWriter *writer,
+                    const char *filename,
+                    int width,
+                    int height)
+{
+   return OpenWriter(writer, filename, width, height, 0);
+}
+
+int OpenPackedImageWriter(ImageWriter *writer,
+                          const char *filename,
+                          int width,
+                          int height)
+{
+   return OpenWriter(writer, filename, width, height, 1);
+}
+
+/* Convert a row of GA8 pixels to 2bit palette indices. */
+static void PackRow(png_const_bytep row, int width, png_bytep packed_row)
+{
+   int x;
+
+   memset(packed_row, 0, (width + 3) / 4);
+   for(x = 0; x < width; x++, row += 2)
+   {
+      if( row[1] > 127 )
+         packed_row[x >> 2] |= (row[0] > 127 ? 2 : 1) << (6 - (x & 3) * 2);
+   }
+}
+
+/* Apply the same thresholds as PackRow, producing GA8 pixels that are
+   identical to what a packed PNG would read back as.                 */
+static void ThresholdRow(png_const_bytep row, int width, png_bytep output)
+{
+   int x;
+
+   for(x = 0; x < width; x++, row += 2, output += 2)
+   {
+      if( row[1] > 127 )
+      {
+         output[0] = row[0] > 127 ? 0xff : 0;
+         output[1] = 0xff;
+      }
+      else
+      {
+         output[0] = output[1] = 0;
+      }
+   }
+}
+
+/* Write a row of raw output.  Returns 1 on success. */
+static int WriteRawRow(ImageWriter *writer, png_const_bytep row)
+{
+   if( writer->packed_row != NULL )
+   {
+      ThresholdRow(row, writer->width, writer->packed_row);
+      row = writer->packed_row;
+   }
+   if( fwrite(row, (size_t)writer->width * IMAGE_PIXEL_SIZE, 1,
+              writer->file) != 1 )
+   {
+      writer->failed = 1;
+      return 0;
+   }
+   writer->current_row++;
+   return 1;
+}
+
+int WriteImageRow(ImageWriter *writer, png_const_bytep row)
+{
+   if( (writer->png == NULL && !writer->raw) || writer->failed ||
+       writer->current_row >= writer->height )
+   {
+      writer->failed = 1;
+      return 0;
+   }
+   if( writer->raw )
+      return WriteRawRow(writer, row);
+   if( setjmp(png_jmpbuf(writer->png)) )
+   {
+      writer->failed = 1;
+      return 0;
+   }
+   if( writer->packed_row != NULL )
+   {
+      PackRow(row, writer->width, writer->packed_row);
+      png_write_row(writer->png, writer->packed_row);
+   }
+   else
+   {
+      png_write_row(writer->png, row);
+   }
+   writer->current_row++;
+   return 1;
+}
+
+int CloseImageWriter(ImageWriter *writer)
+{
+   int ok;
+
+   if( writer->png != NULL && !writer->failed &&
+       writer->current_row == writer->height )
+   {
+      if( setjmp(png_jmpbuf(writer->png)) )
+      {
+         writer->failed = 1;
+      }
+      else
+      {
+         png_write_end(writer->png, writer->info);
+      }
+   }
+   else if( !writer->raw || writer->current_row != writer->height )
+   {
+      writer->failed = 1;
+   }
+
+   if( writer->png != NULL )
+   {
+      png_destroy_write_struct(&writer->png,
+                               writer->info == NULL ? NULL : &writer->info);
+   }
+   if( writer->file != NULL )
+   {
+      if( fflush(writer->file) != 0 || ferror(writer->file) )
+         writer->failed = 1;
+      if( writer->filename != NULL )
+      {
+         if( fclose(writer->file) != 0 )
+            writer->failed = 1;
+         if( writer->failed )
+            remove(writer->filename);
+      }
+   }
+
+   free(writer->packed_row);
+   ok = !writer->failed;
+   memset(writer, 0, sizeof(ImageWriter));
+   return ok;
+}
@@ -0,0 +1,174 @@
+/* Row-streaming image reader and writer shared by all data tools.
+
+   Most data tools only need to look at a few scanlines at a time, so
+   instead of decoding the full image into memory with the simplified
+   libpng API (png_image_finish_read), we decode and encode one row at
+   a time using the classic libpng row API.  This allows tools to run in
+   O(width) memory, and allows a tool at the end of a pipe to start
+   producing output before the tool at the other end has finished.
+
+   All images are converted to 8bit grayscale plus 8bit alpha (GA8) on
+   input, using the same set of transformations as PNG_FORMAT_GA in the
+   simplified API, so pixel values are identical to what we got from
+   png_image_finish_read.  Output images are written as GA8 with settings
+   equivalent to PNG_IMAGE_FLAG_FAST.
+
+   Dithered images only contain three distinct pixel values (transparent,
+   opaque black, opaque white), so there is also a packed writer that
+   encodes those as a 2bit palette image.  This is 8 times fewer bytes to
+   compress and write compared to GA8.  PNG does not allow 1bit grayscale
+   plus 1bit alpha, and a 1bit grayscale image with tRNS can only make
+   one of the two colors transparent, so 2bit palette is the smallest
+   format that is understood by all our other tools.  Packed images read
+   back to exactly the same GA8 pixels.
+
+   Because every data tool goes through this library, there is also a raw
+   uncompressed GA8 format for passing intermediate images between tools
+   without paying for deflate and inflate at every step.  Raw files start
+   with a 16 byte header, followed by rows of GA8 pixels with no padding:
+
+      bytes 0..3:   "\x89GA8" (RAW_IMAGE_MAGIC)
+      bytes 4..7:   format, always RAW_IMAGE_FORMAT_GA8
+      bytes 8..11:  width
+      bytes 12..15: height
+
+   All header fields are 32bit little endian integers.  Readers detect
+   raw input automatically, including from stdin.  If raw input is a
+   regular file, it's mapped into memory, and GetImageRow returns direct
+   pointers into the mapped pages.  Writers produce raw output if the
+   output filename ends with RAW_IMAGE_SUFFIX.  Other programs such as
+   ImageMagick and netpbm don't understand this format, so raw images
+   should only be used between our own tools.
+
+   Usage:
+
+      ImageReader reader;
+      if( !OpenImageReader(&reader, "input.png") )
+         ...error...
+      for(y = 0; y < reader.height; y++)
+      {
+         if( !ReadImageRow(&reader, row) )
+            ...error...
+      }
+      CloseImageReader(&reader);
+
+   For both readers and writers, "-" means stdin or stdout.
+*/
+
+#ifndef IMAGE_IO_H_
+#define IMAGE_IO_H_
+
+#include<png.h>
+#include<stdio.h>
+
+/* Number of bytes per pixel for all images handled by this library. */
+#define IMAGE_PIXEL_SIZE   2
+
+/* Raw image header.  See above for details. */
+#define RAW_IMAGE_MAGIC        "\x89GA8"
+#define RAW_IMAGE_FORMAT_GA8   1
+#define RAW_IMAGE_HEADER_SIZE  16
+#define RAW_IMAGE_SUFFIX       ".ga8"
+
+typedef struct
+{
+   /* Image dimensions in pixels.  Each row is width*2 bytes. */
+   int width, height;
+
+   /* Number of rows returned so far. */
+   int current_row;
+
+   /* Internal state. */
+   png_structp png;
+   png_infop info;
+   FILE *file;
+   int close_file;
+
+   /* Interlaced images can not be decoded one row at a time, so for those
+      we decode the full image in OpenImageReader and serve rows from here.
+      This is NULL for non-interlaced images.                              */
+   png_bytep full_image;
+
+   /* Set for raw input.  If raw input was mapped into memory, raw_pixels
+      points at the first row, otherwise rows are read from file.       */
+   int raw;
+   png_const_bytep raw_pixels;
+   void *raw_map;
+   size_t raw_map_size;
+
+   /* Row buffer for GetImageRow, allocated on first use. */
+   png_bytep row_buffer;
+} ImageReader;
+
+typedef struct
+{
+   /* Image dimensions in pixels. */
+   int width, height;
+
+   /* Number of rows written so far. */
+   int current_row;
+
+   /* Internal state. */
+   png_structp png;
+   png_infop info;
+   FILE *file;
+   const char *filename;
+   int failed;
+
+   /* Scratch buffer for packed writers, NULL for GA8 writers. */
+   png_bytep packed_row;
+
+   /* Set for raw output. */
+   int raw;
+} ImageWriter;
+
+/* Open image for reading.  Returns 1 on success, in which case width and
+   height are set.  Returns 0 on error, in which case the reader does not
+   need to be closed.                                                     */
+int OpenImageReader(ImageReader *reader, const char *filename);
+
+/* Read the next row into "row", which must hold at least width*2 bytes.
+   Returns 1 on success, 0 on error or if there are no more rows.        */
+int ReadImageRow(ImageReader *reader, png_bytep row);
+
+/* Return pointer to the next row, or NULL on error or if there are no
+   more rows.  For raw input that was mapped into memory, and for
+   interlaced PNGs, this points directly into the full image, so no bytes
+   are copied.  Otherwise it points into a buffer owned by the reader.
+   Either way, the pointer is valid until the next call to GetImageRow or
+   CloseImageReader.                                                      */
+png_const_bytep GetImageRow(ImageReader *reader);
+
+/* Release reader resources.  Unread rows are discarded. */
+void CloseImageReader(ImageReader *reader);
+
+/* Open image for writing.  Output is written in raw format if filename
+   ends with RAW_IMAGE_SUFFIX, otherwise it's written as PNG.  Returns 1
+   on success.                                                          */
+int OpenImageWriter(ImageWriter *writer,
+                    const char *filename,
+                    int width,
+                    int height);
+
+/* Open image for writing in packed 2bit palette format.  Rows are
+   still passed in as GA8, pixels with alpha less than 128 are written as
+   transparent, and the remaining pixels are written as black or white
+   depending on whether gray level is less than 128.  If filename ends
+   with RAW_IMAGE_SUFFIX, output is written in raw format instead, with
+   the same pixel values that a packed PNG would read back as.  Returns 1
+   on success.                                                          */
+int OpenPackedImageWriter(ImageWriter *writer,
+                          const char *filename,
+                          int width,
+                          int height);
+
+/* Write the next row, which must contain width*2 bytes.  Returns 1 on
+   success.                                                            */
+int WriteImageRow(ImageWriter *writer, png_const_bytep row);
+
+/* Finish writing image and release writer resources.  Returns 1 if all
+   rows were written successfully.  If any error occurred, the partially
+   written output file is removed.                                      */
+int CloseImageWriter(ImageWriter *writer);
+
+#endif
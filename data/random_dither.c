@@ -2,40 +2,133 @@
 
    Usage:
 
-      ./random_dither {input.png} {output.png}
+      ./random_dither [-j {threads}] {input.png} {output.png}
 
    Use "-" for input or output to read/write from stdin/stdout.
 
    Given a grayscale (8bit) plus alpha (8bit) PNG, output a black and
    white (1bit) plus transparency (1bit) PNG, by using input pixel level
    to probabilistically set the output bit.
+
+   Random thresholds come from a hash of absolute (x,y) pixel coordinates
+   rather than a sequential generator, so they don't depend on the order
+   in which pixels are processed.  Every pixel can be dithered
+   independently, and output is the same on all platforms.
+
+   With "-j", scanlines are dithered in parallel using the specified
+   number of threads.  Output is identical regardless of thread count.
 */
 
-#include<png.h>
+#include<stdint.h>
 #include<stdio.h>
 #include<stdlib.h>
 #include<string.h>
 #include<unistd.h>
+#include"image_io.h"
+#include"worker_pool.h"
 
 #ifdef _WIN32
    #include<fcntl.h>
    #include<io.h>
 #endif
 
-static unsigned char Dither(int v)
+/* Maximum number of threads for "-j". */
+#define MAX_THREADS  MAX_POOL_THREADS
+
+/* Number of scanlines that are read before dithering them in parallel. */
+#define BAND_ROWS    64
+
+/* State for dithering one band of scanlines, shared by all workers.
+   Each worker processes every thread_count'th scanline starting from
+   its worker index.                                                   */
+typedef struct
 {
-   return (255.0f / RAND_MAX) * (float)rand() < v ? 255 : 0;
+   int image_width;
+   int thread_count;
+
+   /* Pixels for the current band.  band_y is the image coordinate of the
+      first row, and band_height is the number of rows that are
+      populated.                                                         */
+   png_bytep band;
+   int band_y;
+   int band_height;
+} Band;
+
+/* Hash pixel coordinates to 64 bits (splitmix64 finalizer). */
+static uint64_t PixelHash(uint32_t x, uint32_t y)
+{
+   uint64_t z = (((uint64_t)y << 32) | x) + 0x9e3779b97f4a7c15ull;
+
+   z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+   z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+   return z ^ (z >> 31);
+}
+
+/* Dither "width" pixels starting at "row", where the first pixel is at
+   (0, y) in image coordinates.
+
+   Thresholds are 16 random bits scaled to [0,254], so that an input
+   level of 0 always produces 0 and a level of 255 always produces 255.
+   Color and alpha use different bits of the same hash.                 */
+static void DitherRow(png_bytep row, int y, int width)
+{
+   uint64_t h;
+   int x;
+   png_bytep p = row;
+
+   for(x = 0; x < width; x++, p += 2)
+   {
+      h = PixelHash((uint32_t)x, (uint32_t)y);
+
+      /* Dither color and alpha independently, and set color part to
+         zero if alpha is zero.                                       */
+      p[1] = (int)(((h & 0xffff) * 255) >> 16) < p[1] ? 255 : 0;
+      p[0] = (int)((((h >> 16) & 0xffff) * 255) >> 16) < p[0]
+             ? p[1] : 0;
+   }
+}
+
+/* Dither all scanlines assigned to a single worker. */
+static void DitherRows(void *context, int worker)
+{
+   const Band *b = (const Band*)context;
+   int y;
+
+   for(y = worker; y < b->band_height; y += b->thread_count)
+   {
+      DitherRow(b->band + (size_t)y * b->image_width * IMAGE_PIXEL_SIZE,
+                b->band_y + y, b->image_width);
+   }
 }
 
 int main(int argc, char **argv)
 {
-   png_image image;
-   png_bytep pixels, p;
-   int x, y;
+   ImageReader reader;
+   ImageWriter writer;
+   WorkerPool pool;
+   Band b;
+   const char *input, *output;
+   png_bytep band;
+   int thread_count, arg, x, y, band_y;
+
+   thread_count = 1;
+   arg = 1;
+   if( argc == 5 && strcmp(argv[1], "-j") == 0 )
+   {
+      thread_count = atoi(argv[2]);
+      if( thread_count < 1 || thread_count > MAX_THREADS )
+      {
+         printf("Invalid thread count: %s\n", argv[2]);
+         return 1;
+      }
+      arg = 3;
+   }
+   if( argc != arg + 2 )
+      return printf("%s [-j {threads}] {input.png} {output.png}\n", *argv);
+   input = argv[arg];
+   output = argv[arg + 1];
 
-   if( argc != 3 )
-      return printf("%s {input.png} {output.png}\n", *argv);
-   if( strcmp(argv[2], "-") == 0 && isatty(STDOUT_FILENO) )
+   if( strcmp(output, "-") == 0 && isatty(STDOUT_FILENO) )
    {
       fputs("Not writing output to stdout because it's a tty\n", stderr);
       return 1;
@@ -45,71 +138,91 @@ int main(int argc, char **argv)
       setmode(STDOUT_FILENO, O_BINARY);
    #endif
 
-   /* Load input. */
-   memset(&image, 0, sizeof(image));
-   image.version = PNG_IMAGE_VERSION;
-   if( strcmp(argv[1], "-") == 0 )
+   /* Open input. */
+   if( !OpenImageReader(&reader, input) )
    {
-      if( !png_image_begin_read_from_stdio(&image, stdin) )
+      if( strcmp(input, "-") == 0 )
          return puts("Error reading from stdin");
+      return printf("Error reading %s\n", input);
    }
-   else
+   band = (png_bytep)malloc(
+      (size_t)reader.width * BAND_ROWS * IMAGE_PIXEL_SIZE);
+   if( band == NULL )
    {
-      if( !png_image_begin_read_from_file(&image, argv[1]) )
-         return printf("Error reading %s\n", argv[1]);
-   }
-   image.format = PNG_FORMAT_GA;
-   pixels = (png_bytep)malloc(PNG_IMAGE_SIZE(image));
-   if( pixels == NULL )
+      CloseImageReader(&reader);
       return puts("Out of memory");
-   if( !png_image_finish_read(&image, NULL, pixels, 0, NULL) )
+   }
+
+   /* Open output. */
+   if( !OpenImageWriter(&writer, output, reader.width, reader.height) )
    {
-      free(pixels);
-      return printf("Error loading %s\n", argv[1]);
+      if( strcmp(output, "-") == 0 )
+         fputs("Error writing to stdout\n", stderr);
+      else
+         printf("Error writing %s\n", output);
+      CloseImageReader(&reader);
+      free(band);
+      return 1;
    }
 
-   /* Use fixed seed for deterministic output. */
-   srand(1);
+   /* There is no point in having more threads than rows per band. */
+   if( thread_count > BAND_ROWS )
+      thread_count = BAND_ROWS;
+   b.image_width = reader.width;
+   b.thread_count = thread_count;
+   b.band = band;
+   StartWorkerPool(&pool, thread_count);
 
-   /* Dither pixels. */
-   p = pixels;
-   for(y = 0; y < (int)image.height; y++)
+   /* Dither pixels one band at a time. */
+   for(y = 0; y < reader.height; y += BAND_ROWS)
    {
-      for(x = 0; x < (int)image.width; x++, p += 2)
+      for(band_y = 0; band_y < BAND_ROWS && y + band_y < reader.height;
+          band_y++)
       {
-         /* Dither color and alpha independently. */
-         *p = Dither((int)*p);
-         *(p + 1) = Dither((int)*(p + 1));
+         if( !ReadImageRow(&reader,
+                           band + band_y * reader.width * IMAGE_PIXEL_SIZE) )
+         {
+            break;
+         }
+      }
+      if( y + band_y < reader.height && band_y < BAND_ROWS )
+         break;
+      b.band_y = y;
+      b.band_height = band_y;
+      RunWorkerPool(&pool, DitherRows, &b);
 
-         /* Set color part to zero if alpha is zero. */
-         if( *(p + 1) == 0 )
-            *p = 0;
+      for(x = 0; x < band_y; x++)
+      {
+         if( !WriteImageRow(&writer,
+                            band + x * reader.width * IMAGE_PIXEL_SIZE) )
+         {
+            break;
+         }
       }
+      if( x < band_y )
+         break;
    }
 
-   /* Write output.  Here we set the flags to optimize for encoding speed
-      rather than output size so that we can iterate faster.  This is fine
-      since the output of this tool are intermediate files that are used
-      only in the build process, and are not the final PNGs that will be
-      committed.                                                           */
-   image.flags |= PNG_IMAGE_FLAG_FAST;
+   StopWorkerPool(&pool);
+
+   /* Check for errors.  Read errors are reported here, write errors are
+      reported when closing the writer.                                 */
    x = 0;
-   if( strcmp(argv[2], "-") == 0 )
+   if( y < reader.height && reader.current_row < reader.height &&
+       reader.current_row < y + BAND_ROWS )
    {
-      if( !png_image_write_to_stdio(&image, stdout, 0, pixels, 0, NULL) )
-      {
-         fputs("Error writing to stdout\n", stderr);
-         x = 1;
-      }
+      printf("Error loading %s\n", input);
+      x = 1;
    }
-   else
+   CloseImageReader(&reader);
+   free(band);
+   if( !CloseImageWriter(&writer) && x == 0 )
    {
-      if( !png_image_write_to_file(&image, argv[2], 0, pixels, 0, NULL) )
-      {
-         printf("Error writing %s\n", argv[2]);
-         x = 1;
-      }
+      if( strcmp(output, "-") == 0 )
+         fputs("Error writing to stdout\n", stderr);
+      else
+         printf("Error writing %s\n", output);
+      x = 1;
    }
-   free(pixels);
    return x;
 }
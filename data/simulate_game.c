@@ -0,0 +1,1561 @@
+/* Run simulate_game() from main.lua natively, for batch benchmarking.
+
+   Usage:
+
+      ./simulate_game [-v] [-c] [-j {threads}] {first_seed} {last_seed}
+      ./simulate_game [-c] [--threads {threads}] [--seed {first_seed}]
+                      --games {count}
+
+   Simulates games for all seeds in the range of [first_seed, last_seed],
+   and writes results to stdout in the same format as the debug log
+   produced by simulate_game() in main.lua:
+
+      [0.012000]: simulate_game(1)
+      [0.014000]: scissors wins, steps = 1237
+
+   This means the output can be fed to simulation_experiments.pl as is.
+   Timestamps are seconds since start of the run.
+
+   With "-v", also include debug counter reports and respawn messages.
+   Excluding timestamps, verbose output for a particular seed should be
+   identical to what main.lua would log for the same seed, which is how
+   this tool is checked against simulation_experiments.log.
+
+   With "-c", every victim search done through the victim index is
+   checked against a linear scan of the object list, which is how
+   follow_next_victim is implemented in main.lua.  Any mismatch is
+   reported to stderr and causes an immediate exit with failure status.
+
+   With "-j", games are simulated in parallel using the specified number
+   of threads.  Each game is independent of the others, so results are
+   the same regardless of thread count, and they are always written in
+   seed order.
+
+   With "--games", games are simulated for seeds in the range of
+   [first_seed, first_seed+count-1] (first_seed defaults to 1), and
+   instead of the debug log, a summary is written to stdout as CSV with
+   "key,value" rows:
+
+      games, first_seed, threads, seconds, games_per_second
+      {kind}_wins, {kind}_win_rate          (for rock, paper, scissors)
+      min_steps, max_steps, average_steps
+      steps_{low}_{high}                    (histogram of game lengths)
+
+   Histogram buckets are STEP_HISTOGRAM_BUCKET steps wide, covering
+   [0, max_steps].  This replaces scraping the debug log with
+   simulation_experiments.pl.  "--threads" is the same as "-j".
+
+   Each game seeds its own random number generator from its seed, so
+   every game sees the same random stream no matter which thread runs
+   it.  Only seconds and games_per_second depend on thread count.
+   Threads take games from a shared counter as they finish, so long
+   games don't hold up other threads.
+
+   Game logic mirrors update_obj, update_slime, follow_next_victim,
+   kill_obj, remove_wall_tile, maybe_respawn, and run_simulation_step,
+   using the same 1-based collision_table layout and the same sequence
+   of random numbers.  Random numbers are generated using the same
+   algorithm as Lua 5.4's math.random (xoshiro256**).  Only the parts of
+   main.lua that affect simulation outcome are reproduced, so there is
+   no tilemap or drawing state here.  Simulation runs with the same
+   implicit settings as simulate_game() in spectator mode: there is no
+   player-controlled object, and the view is centered at (0,0).
+
+   Tables for velocities and angles are converted from data.lua by
+   generate_simulation_data.pl.
+
+   When compiled with -DSIMULATE_GAME_STATS (simulate_game_stats.exe in
+   Makefile), hot path counters and timers are collected and written to
+   stderr as "key,value" rows after all games are done.  Each thread
+   accumulates into its own Game, and totals are merged when the thread
+   exits.  Without that flag, all instrumentation compiles to nothing.
+   Timers use the CPU timestamp counter where available, so they are in
+   cycles rather than seconds.
+*/
+
+#include<pthread.h>
+#include<stdarg.h>
+#include<stdatomic.h>
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<time.h>
+#include"t_simulation_data.h"
+
+#ifdef SIMULATE_GAME_STATS
+   #if defined(__x86_64__) || defined(__i386__)
+      #include<x86intrin.h>
+   #endif
+#endif
+
+/* Maximum number of threads for "-j". */
+#define MAX_THREADS  256
+
+/* Width of game length histogram buckets for "--games". */
+#define STEP_HISTOGRAM_BUCKET  250
+
+/* Constants from main.lua. */
+#define KIND_ROCK          1
+#define KIND_PAPER         2
+#define KIND_SCISSORS      3
+#define KIND_LIGHT_SLIME   4
+#define STATE_DEAD         0
+#define STATE_DYING        1
+#define STATE_LIVE         2
+
+#define WORLD_SIZE           1280
+#define HORIZONTAL_PADDING   ((400 / 2) + 32)
+#define VERTICAL_PADDING     ((240 / 2) + 32)
+#define POPULATION_COUNT     99
+#define OBJECT_COUNT         (POPULATION_COUNT * 3 + 16)
+
+#define COLLISION_TABLE_WIDTH   ((WORLD_SIZE + HORIZONTAL_PADDING * 2) >> 3)
+#define COLLISION_TABLE_HEIGHT  ((WORLD_SIZE + VERTICAL_PADDING * 2) >> 3)
+#define FLOOR_TABLE_WIDTH       ((COLLISION_TABLE_WIDTH >> 3) + 2)
+#define FLOOR_TABLE_HEIGHT      ((COLLISION_TABLE_HEIGHT >> 3) + 2)
+
+#define GAME_AREA_MIN_X  (HORIZONTAL_PADDING >> 3)
+#define GAME_AREA_MAX_X  ((HORIZONTAL_PADDING + WORLD_SIZE) >> 3)
+#define GAME_AREA_MIN_Y  (VERTICAL_PADDING >> 3)
+#define GAME_AREA_MAX_Y  ((VERTICAL_PADDING + WORLD_SIZE) >> 3)
+
+#define MAX_WORLD_POSITIONS  ((WORLD_SIZE / 64) * (WORLD_SIZE / 64))
+
+/* Convert world coordinate to collision_table coordinate.  Collision
+   table coordinates are 1-based, same as main.lua.                     */
+#define CELL(v)  (((v) + 0x400) >> 11)
+
+/* Convert 1-based collision_table coordinates to index. */
+#define GRID_INDEX(x, y)  (((y) - 1) * COLLISION_TABLE_WIDTH + (x) - 1)
+
+/* Cell offset from one row to the next. */
+#define GRID_STRIDE  COLLISION_TABLE_WIDTH
+
+/* collision_table value for walls, which was -1 in main.lua. */
+#define WALL_CELL  0xffff
+
+/* Lookup coarse_atan[dx][dy]. */
+#define COARSE_ATAN(dx, dy)  \
+   coarse_atan[(dx) + COARSE_ATAN_OFFSET][(dy) + COARSE_ATAN_OFFSET]
+
+/* Instrumentation counters, for SIMULATE_GAME_STATS. */
+enum
+{
+   STAT_GAMES,
+   STAT_STEPS,
+   STAT_MOVES,              /* Objects moving to a different cell. */
+   STAT_COLLISION_CHECKS,   /* Calls to CheckCell. */
+   STAT_COLLISIONS,         /* Moves blocked by an obstacle. */
+   STAT_KILLS,
+   STAT_WALL_BREAK_ATTEMPTS,
+   STAT_WALL_BREAKS,
+   STAT_RESPAWNS,
+   STAT_RETARGETS,          /* Calls to follow_next_victim. */
+   STAT_COUNT
+};
+
+/* Instrumentation timers, for SIMULATE_GAME_STATS. */
+enum
+{
+   TIMER_INIT,              /* InitWorld. */
+   TIMER_STEP,              /* RunSimulationStep, including subphases. */
+   TIMER_UPDATE_OBJ,        /* All UpdateObj calls in a step. */
+   TIMER_UPDATE_SLIME,      /* All UpdateSlime calls in a step. */
+   TIMER_RESPAWN,           /* MaybeRespawn. */
+   TIMER_VICTIM_SEARCH,     /* Victim search in FollowNextVictim. */
+   TIMER_COUNT
+};
+
+/* Accumulated counters and timers. */
+typedef struct
+{
+   uint64_t count[STAT_COUNT];
+   uint64_t time[TIMER_COUNT];
+} Stats;
+
+#ifdef SIMULATE_GAME_STATS
+   #define STATS_ADD(game, stat)  ((game)->stats.count[stat]++)
+   #define TIMER_START(t)         const uint64_t t = ReadTimer()
+   #define TIMER_STOP(game, timer, t) \
+      ((game)->stats.time[timer] += ReadTimer() - (t))
+#else
+   #define STATS_ADD(game, stat)
+   #define TIMER_START(t)
+   #define TIMER_STOP(game, timer, t)
+#endif
+
+/* Random number generator state, equivalent to Lua 5.4's math.random. */
+typedef struct
+{
+   uint64_t s[4];
+} Random;
+
+/* Object states, stored as one array per field.  All fields have the
+   same meaning as obj_table entries in main.lua, and all arrays are
+   indexed by [1..OBJECT_COUNT] as in main.lua, with entry 0 unused.
+
+   Keeping fields in separate arrays means loops that only look at one
+   or two fields (e.g. the state and kind checks in follow_next_victim)
+   read consecutive memory, and the small fields can use narrow types.
+   ta is the target direction, and a is the current direction, which
+   selects the velocity.                                                */
+typedef struct
+{
+   int32_t x[OBJECT_COUNT + 1];
+   int32_t y[OBJECT_COUNT + 1];
+   uint8_t kind[OBJECT_COUNT + 1];
+   uint8_t state[OBJECT_COUNT + 1];
+   uint8_t frame[OBJECT_COUNT + 1];
+   uint8_t a[OBJECT_COUNT + 1];
+   uint8_t ta[OBJECT_COUNT + 1];
+   uint8_t ka[OBJECT_COUNT + 1];
+   uint8_t stun[OBJECT_COUNT + 1];
+} Objects;
+
+/* Index for finding the victim that follow_next_victim would pick.
+
+   follow_next_victim doesn't pick the nearest victim.  It scans forward
+   from the current object in obj_table order, counting +1 for each live
+   killer and -1 for each live victim, and stops at the first victim
+   where the running balance drops below zero.  This means the victim
+   search is a "find first prefix sum below zero" query, which we can
+   answer in O(log N) with a segment tree over object indices, instead of
+   walking the object list.
+
+   There is one tree per killer kind, indexed by [KIND_*].  Each leaf is
+   +1 for a live object of the killer kind, -1 for a live victim, and 0
+   otherwise.  Each node stores the sum of all leaves below it, the
+   minimum prefix sum over those leaves, and the number of victims.
+   Trees are updated incrementally whenever an object is killed or
+   respawned.  Leaf for object i is at node VICTIM_INDEX_LEAVES+i-1.     */
+#define VICTIM_INDEX_LEAVES  512
+typedef struct
+{
+   int16_t sum[VICTIM_INDEX_LEAVES * 2];
+   int16_t min_prefix[VICTIM_INDEX_LEAVES * 2];
+   int16_t victims[VICTIM_INDEX_LEAVES * 2];
+} VictimIndex;
+
+/* Growable text buffer for log output. */
+typedef struct
+{
+   char *text;
+   size_t size, capacity;
+} Log;
+
+/* Complete state for a single game. */
+typedef struct
+{
+   Random random;
+
+   Objects obj;
+
+   /* Cell occupancy status, one flat array indexed by GRID_INDEX.
+
+      0 = empty, WALL_CELL = wall, other = index into obj.
+
+      All cells outside of the game area are walls, and objects never
+      leave the game area, so all neighbors of any cell touched by an
+      object are always within the array.                              */
+   uint16_t collision_table[COLLISION_TABLE_HEIGHT * COLLISION_TABLE_WIDTH];
+
+   /* Indices of rock/paper/scissors objects that are not dead, in
+      increasing order.  Dead objects don't do anything in update_obj,
+      so only these need to be visited.  Late in the game, most of the
+      population is dead, and visiting only the remaining few objects
+      makes those endgame steps much cheaper.                          */
+   uint16_t active[POPULATION_COUNT * 3];
+   int active_count;
+
+   /* Victim search trees, indexed by killer kind. */
+   VictimIndex victim_index[4];
+
+   /* If set, check each indexed victim search against a linear scan. */
+   int check_victims;
+
+   /* Initial object positions, in world coordinates. */
+   int world_positions[MAX_WORLD_POSITIONS][2];
+   int world_position_count;
+
+   /* Number of live objects for each kind, indexed by [KIND_*]. */
+   int live_count[4];
+
+   int game_steps;
+   int action_frame_mask;
+   int respawn_x, respawn_y;
+
+   /* Debug counters, same as global_debug_count_* in main.lua. */
+   int debug_count_same_cell;
+   int debug_count_collision;
+   int debug_count_no_collision;
+
+   /* Output messages.  If verbose is not set, only the messages that
+      simulate_game() logs directly are recorded.                      */
+   int verbose;
+   Log log;
+
+   /* Instrumentation for all games run by the current thread.  Only
+      updated with SIMULATE_GAME_STATS.                               */
+   Stats stats;
+} Game;
+
+/* Outcome of a single game. */
+typedef struct
+{
+   int winner;
+   int steps;
+} GameResult;
+
+/* Shared state for all threads.  If logs is NULL, log messages are
+   discarded, and only results are kept.                              */
+typedef struct
+{
+   int first_seed, game_count, verbose, check_victims;
+   Log *logs;
+   GameResult *results;
+   atomic_int next_game;
+
+   /* Instrumentation totals for all threads, guarded by stats_lock. */
+   Stats stats;
+   pthread_mutex_t stats_lock;
+} Batch;
+
+/* Names for each object kind, indexed by [KIND_*]. */
+static const char *kind_names[4] = {"", "rock", "paper", "scissors"};
+
+/* Time when program started, for log timestamps. */
+static struct timespec start_time;
+
+#ifdef SIMULATE_GAME_STATS
+/* Names for Stats entries, indexed by STAT_* and TIMER_*. */
+static const char *stat_names[STAT_COUNT] =
+{
+   "games", "steps", "moves", "collision_checks", "collisions", "kills",
+   "wall_break_attempts", "wall_breaks", "respawns", "retargets"
+};
+static const char *timer_names[TIMER_COUNT] =
+{
+   "init", "step", "update_obj", "update_slime", "respawn", "victim_search"
+};
+
+/* Read timestamp for instrumentation timers. */
+static uint64_t ReadTimer(void)
+{
+   #if defined(__x86_64__) || defined(__i386__)
+      return __rdtsc();
+   #else
+      struct timespec now;
+      clock_gettime(CLOCK_MONOTONIC, &now);
+      return (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+   #endif
+}
+#endif
+
+/* Append a formatted debug message to game log. */
+static void DebugLog(Game *game, const char *format, ...)
+{
+   struct timespec now;
+   va_list args;
+   Log *log = &game->log;
+   int size;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   for(;;)
+   {
+      size_t available = log->capacity - log->size;
+      size = snprintf(log->text + log->size, available, "[%f]: ",
+                      (double)(now.tv_sec - start_time.tv_sec) +
+                      (now.tv_nsec - start_time.tv_nsec) / 1e9);
+      if( size >= 0 && (size_t)size < available )
+      {
+         va_start(args, format);
+         size += vsnprintf(log->text + log->size + size, available - size,
+                           format, args);
+         va_end(args);
+         if( (size_t)size + 1 < available )
+         {
+            log->text[log->size + size] = '\n';
+            log->size += size + 1;
+            log->text[log->size] = '\0';
+            return;
+         }
+      }
+
+      log->capacity = log->capacity * 2 + 256;
+      log->text = (char*)realloc(log->text, log->capacity);
+      if( log->text == NULL )
+      {
+         fputs("Out of memory\n", stderr);
+         exit(EXIT_FAILURE);
+      }
+   }
+}
+
+/* ....................................................................... */
+/* {{{ Random numbers. */
+
+static uint64_t RotateLeft(uint64_t x, int n)
+{
+   return (x << n) | (x >> (64 - n));
+}
+
+/* Equivalent to nextrand() in lmathlib.c */
+static uint64_t NextRandom(Random *r)
+{
+   const uint64_t s0 = r->s[0];
+   const uint64_t s1 = r->s[1];
+   const uint64_t s2 = r->s[2] ^ s0;
+   const uint64_t s3 = r->s[3] ^ s1;
+   const uint64_t result = RotateLeft(s1 * 5, 7) * 9;
+
+   r->s[0] = s0 ^ s3;
+   r->s[1] = s1 ^ s2;
+   r->s[2] = s2 ^ (s1 << 17);
+   r->s[3] = RotateLeft(s3, 45);
+   return result;
+}
+
+/* Equivalent to math.randomseed(seed). */
+static void SeedRandom(Random *r, int64_t seed)
+{
+   int i;
+
+   r->s[0] = (uint64_t)seed;
+   r->s[1] = 0xff;
+   r->s[2] = 0;
+   r->s[3] = 0;
+   for(i = 0; i < 16; i++)
+      NextRandom(r);
+}
+
+/* Equivalent to math.random(low, up). */
+static int RandomRange(Random *r, int low, int up)
+{
+   const uint64_t n = (uint64_t)((int64_t)up - low);
+   uint64_t ran = NextRandom(r);
+   uint64_t lim;
+
+   /* Same as project() in lmathlib.c */
+   if( (n & (n + 1)) == 0 )
+      return (int)((ran & n) + low);
+
+   lim = n;
+   lim |= lim >> 1;
+   lim |= lim >> 2;
+   lim |= lim >> 4;
+   lim |= lim >> 8;
+   lim |= lim >> 16;
+   lim |= lim >> 32;
+   while( (ran &= lim) > n )
+      ran = NextRandom(r);
+   return (int)(ran + low);
+}
+
+/* Equivalent to math.random(up). */
+static int Random1(Random *r, int up)
+{
+   return RandomRange(r, 1, up);
+}
+
+/* }}} */
+
+/* ....................................................................... */
+/* {{{ Game functions. */
+
+/* Count number of object kinds that are still surviving. */
+static int LiveKindCount(const Game *game)
+{
+   return (game->live_count[KIND_ROCK] != 0) +
+          (game->live_count[KIND_PAPER] != 0) +
+          (game->live_count[KIND_SCISSORS] != 0);
+}
+
+/* Overwrite content of the 4 cells near a world coordinate. */
+static void SetOccupant(Game *game, int x, int y, int occupant)
+{
+   uint16_t *c = game->collision_table + GRID_INDEX(CELL(x), CELL(y));
+
+   c[0] = c[1] = c[GRID_STRIDE] = c[GRID_STRIDE + 1] = (uint16_t)occupant;
+}
+
+/* Check if all 4 cells starting at collision_table index are empty. */
+static int IsEmpty(const uint16_t *c)
+{
+   return (c[0] | c[1] | c[GRID_STRIDE] | c[GRID_STRIDE + 1]) == 0;
+}
+
+/* Set value for a single leaf in victim index and update its ancestors.
+   Index is 1-based, same as obj.                                       */
+static void SetVictimIndexLeaf(VictimIndex *t, int index, int value)
+{
+   int node = VICTIM_INDEX_LEAVES + index - 1, left, right, m;
+
+   t->sum[node] = t->min_prefix[node] = (int16_t)value;
+   t->victims[node] = value < 0;
+   for(node >>= 1; node > 0; node >>= 1)
+   {
+      left = node * 2;
+      right = left + 1;
+      t->sum[node] = t->sum[left] + t->sum[right];
+      m = t->sum[left] + t->min_prefix[right];
+      t->min_prefix[node] = t->min_prefix[left] < m ? t->min_prefix[left]
+                                                    : (int16_t)m;
+      t->victims[node] = t->victims[left] + t->victims[right];
+   }
+}
+
+/* Update victim indices after an object changed state.  Each object
+   appears in two trees: once as a killer and once as a victim.         */
+static void UpdateVictimIndex(Game *game, int index)
+{
+   const int kind = game->obj.kind[index];
+   const int live = game->obj.state[index] == STATE_LIVE;
+
+   SetVictimIndexLeaf(&game->victim_index[kind], index, live);
+   SetVictimIndexLeaf(&game->victim_index[kind % 3 + 1], index, -live);
+}
+
+/* Find the first position p >= lo where *balance plus the sum of leaves
+   from lo to p drops below zero.  Returns 0 if there is no such position,
+   in which case *balance is updated to include all leaves from lo to the
+   end.
+
+   Search starts at the leaf for lo and walks up and to the right, so the
+   cost is proportional to log(p-lo) rather than log(N).  This matters
+   because the victim is usually only a few objects away.                */
+static int FindFirstVictim(const VictimIndex *t, int lo, int *balance)
+{
+   int node = VICTIM_INDEX_LEAVES + lo - 1;
+
+   for(;;)
+   {
+      if( *balance + t->min_prefix[node] < 0 )
+         break;
+      *balance += t->sum[node];
+
+      /* Move to the next subtree to the right. */
+      while( (node & 1) != 0 )
+         node >>= 1;
+      if( node == 0 )
+         return 0;
+      node++;
+   }
+
+   /* Descend to the first leaf where balance drops below zero. */
+   while( node < VICTIM_INDEX_LEAVES )
+   {
+      node *= 2;
+      if( *balance + t->min_prefix[node] >= 0 )
+      {
+         *balance += t->sum[node];
+         node++;
+      }
+   }
+   return node - VICTIM_INDEX_LEAVES + 1;
+}
+
+/* Find the last victim at or before position hi.  Returns 0 if there is
+   no such victim.                                                      */
+static int FindLastVictim(const VictimIndex *t, int hi)
+{
+   int node = VICTIM_INDEX_LEAVES + hi - 1;
+
+   while( t->victims[node] == 0 )
+   {
+      /* Move to the next subtree to the left. */
+      while( (node & 1) == 0 )
+         node >>= 1;
+      if( node == 1 )
+         return 0;
+      node--;
+   }
+
+   /* Descend to the last victim leaf. */
+   while( node < VICTIM_INDEX_LEAVES )
+   {
+      node = node * 2 + 1;
+      if( t->victims[node] == 0 )
+         node--;
+   }
+   return node - VICTIM_INDEX_LEAVES + 1;
+}
+
+/* Rebuild all victim indices from current object states. */
+static void InitVictimIndex(Game *game)
+{
+   int i;
+
+   memset(game->victim_index, 0, sizeof(game->victim_index));
+   for(i = 1; i <= POPULATION_COUNT * 3; i++)
+      UpdateVictimIndex(game, i);
+}
+
+/* Generate initial object positions, same as init_world_positions. */
+static void InitWorldPositions(Game *game)
+{
+   int i = 0, x, y;
+
+   for(y = GAME_AREA_MIN_Y + 3; y <= GAME_AREA_MAX_Y - 3; y += 16)
+   {
+      for(x = GAME_AREA_MIN_X + 3; x <= GAME_AREA_MAX_X - 3; x += 8)
+      {
+         game->world_positions[i][0] = x << 11;
+         game->world_positions[i][1] = y << 11;
+         i++;
+      }
+      for(x = GAME_AREA_MIN_X + 7; x <= GAME_AREA_MAX_X - 3; x += 8)
+      {
+         game->world_positions[i][0] = x << 11;
+         game->world_positions[i][1] = (y + 8) << 11;
+         i++;
+      }
+   }
+   game->world_position_count = i;
+}
+
+/* Initialize collision_table, same as init_walls_and_floors.
+
+   main.lua builds the map in scratch_table and copies it to
+   collision_table at the end.  Here we build it in collision_table
+   directly.  Wall and floor tiles don't affect simulation, but we still
+   need to generate the same random numbers for them.                   */
+static void InitWalls(Game *game)
+{
+   uint16_t *target = game->collision_table;
+   int x, y, i, c, special_x, special_y, floor_shift_x, floor_shift_y;
+
+   /* Populate all cells with random values. */
+   for(i = 0; i < COLLISION_TABLE_HEIGHT * COLLISION_TABLE_WIDTH; i++)
+      target[i] = Random1(&game->random, 101) < 45 ? 1 : 0;
+
+   /* Apply a few rounds of smoothing.  Note that main.lua computes
+      "next_index = 2 - scratch_index" with scratch_index=1, so source
+      and target are always the same table, and each cell is updated in
+      place using the already updated values of its neighbors above and
+      to the left.  We do the same here.                                */
+   for(i = 0; i < 4; i++)
+   {
+      for(y = 2; y <= COLLISION_TABLE_HEIGHT - 1; y++)
+      {
+         for(x = 2; x <= COLLISION_TABLE_WIDTH - 1; x++)
+         {
+            c = GRID_INDEX(x, y);
+            target[c] =
+               (target[c - GRID_STRIDE - 1] + target[c - GRID_STRIDE] +
+                target[c - GRID_STRIDE + 1] +
+                target[c - 1] + target[c] + target[c + 1] +
+                target[c + GRID_STRIDE - 1] + target[c + GRID_STRIDE] +
+                target[c + GRID_STRIDE + 1]) / 5;
+         }
+      }
+   }
+
+   /* Fill borders. */
+   for(y = 1; y <= COLLISION_TABLE_HEIGHT; y++)
+   {
+      for(x = 1; x <= COLLISION_TABLE_WIDTH; x++)
+      {
+         if( y < GAME_AREA_MIN_Y || y > GAME_AREA_MAX_Y ||
+             x < GAME_AREA_MIN_X || x > GAME_AREA_MAX_X )
+         {
+            target[GRID_INDEX(x, y)] = 1;
+         }
+      }
+   }
+
+   /* Open up holes to ensure that objects have room to spawn. */
+   for(i = 0; i < OBJECT_COUNT; i++)
+   {
+      SetOccupant(game,
+                  game->world_positions[i][0],
+                  game->world_positions[i][1],
+                  0);
+   }
+
+   /* Convert entries from {0, 1} to {0, WALL_CELL}. */
+   for(i = 0; i < COLLISION_TABLE_HEIGHT * COLLISION_TABLE_WIDTH; i++)
+      target[i] = target[i] != 0 ? WALL_CELL : 0;
+
+   /* Wall tiles: one random variation for each open cell that is not on
+      the edge.                                                          */
+   for(y = 2; y <= COLLISION_TABLE_HEIGHT - 1; y++)
+   {
+      for(x = 2; x <= COLLISION_TABLE_WIDTH - 1; x++)
+      {
+         if( target[GRID_INDEX(x, y)] == 0 )
+            RandomRange(&game->random, 0, 7);
+      }
+   }
+
+   /* Floor tiles: first row is completely random, and each subsequent row
+      has one random tile followed by tiles with random lower 6 bits.    */
+   for(x = 1; x <= FLOOR_TABLE_WIDTH; x++)
+      Random1(&game->random, 256);
+   for(y = 2; y <= FLOOR_TABLE_HEIGHT; y++)
+   {
+      RandomRange(&game->random, 0, 255);
+      for(x = 2; x <= FLOOR_TABLE_WIDTH; x++)
+         RandomRange(&game->random, 0, 63);
+   }
+
+   /* Special floor tile, which determines respawn area. */
+   special_x = Random1(&game->random, WORLD_SIZE / 64 - 4) +
+               (HORIZONTAL_PADDING / 64) + 2;
+   special_y = Random1(&game->random, WORLD_SIZE / 64 - 4) +
+               (VERTICAL_PADDING / 64) + 2;
+   Random1(&game->random, 16);
+
+   floor_shift_x = Random1(&game->random, 64);
+   floor_shift_y = Random1(&game->random, 64);
+   game->respawn_x = (special_x << 3) - ((floor_shift_x + 4) >> 3) - 7;
+   game->respawn_y = (special_y << 3) - ((floor_shift_y + 4) >> 3) + 1;
+}
+
+/* Randomize all objects and bring them to life, same as init_world. */
+static void InitWorld(Game *game)
+{
+   Objects *obj = &game->obj;
+   int i, j, t;
+
+   /* Shuffle world positions with Fisher-Yates shuffle. */
+   for(i = game->world_position_count; i >= 2; i--)
+   {
+      j = RandomRange(&game->random, 1, i);
+      t = game->world_positions[i - 1][0];
+      game->world_positions[i - 1][0] = game->world_positions[j - 1][0];
+      game->world_positions[j - 1][0] = t;
+      t = game->world_positions[i - 1][1];
+      game->world_positions[i - 1][1] = game->world_positions[j - 1][1];
+      game->world_positions[j - 1][1] = t;
+   }
+
+   InitWalls(game);
+
+   /* Assign object positions and set initial states. */
+   for(i = 1; i <= OBJECT_COUNT; i++)
+   {
+      obj->kind[i] = i <= POPULATION_COUNT * 3 ? (i - 1) % 3 + 1
+                                               : KIND_LIGHT_SLIME + (i & 1);
+      obj->state[i] = STATE_LIVE;
+      obj->x[i] = game->world_positions[i - 1][0];
+      obj->y[i] = game->world_positions[i - 1][1];
+      SetOccupant(game, obj->x[i], obj->y[i], i);
+      obj->frame[i] = RandomRange(&game->random, 1, 16);
+      obj->a[i] = RandomRange(&game->random, 1, 32);
+      obj->ta[i] = obj->a[i];
+      obj->ka[i] = 0;
+      obj->stun[i] = 0;
+   }
+
+   game->live_count[KIND_ROCK] = POPULATION_COUNT;
+   game->live_count[KIND_PAPER] = POPULATION_COUNT;
+   game->live_count[KIND_SCISSORS] = POPULATION_COUNT;
+   InitVictimIndex(game);
+   for(i = 0; i < POPULATION_COUNT * 3; i++)
+      game->active[i] = (uint16_t)(i + 1);
+   game->active_count = POPULATION_COUNT * 3;
+   game->game_steps = 0;
+   game->action_frame_mask = 15;
+   game->debug_count_same_cell = 0;
+   game->debug_count_collision = 0;
+   game->debug_count_no_collision = 0;
+}
+
+/* Lua's floor division operator ("//"). */
+static int FloorDiv(int a, int b)
+{
+   const int q = a / b;
+   return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+/* Given a nonzero vector, compute direction angle to reach that position,
+   same as get_direction.                                               */
+static int GetDirection(int dx, int dy)
+{
+   const int s = COARSE_ATAN_STEPS;
+
+   if( dx < 0 )
+   {
+      if( dy < 0 )
+      {
+         return dx < dy ? COARSE_ATAN(-s, FloorDiv(-s * dy, dx))
+                        : COARSE_ATAN(FloorDiv(-s * dx, dy), -s);
+      }
+      return -dx > dy ? COARSE_ATAN(-s, FloorDiv(-s * dy, dx))
+                      : COARSE_ATAN(FloorDiv(s * dx, dy), s);
+   }
+   if( dy < 0 )
+   {
+      return dx > -dy ? COARSE_ATAN(s, FloorDiv(s * dy, dx))
+                      : COARSE_ATAN(FloorDiv(-s * dx, dy), -s);
+   }
+   return dx > dy ? COARSE_ATAN(s, FloorDiv(s * dy, dx))
+                  : COARSE_ATAN(FloorDiv(s * dx, dy), s);
+}
+
+/* Find the next live victim to follow by matching killers and victims
+   like parentheses, same as the loop in follow_next_victim.  See
+   main.lua for details.  This is the reference implementation for
+   IndexedVictimSearch.                                                */
+static int LinearVictimSearch(const Game *game, int index, int victim_kind)
+{
+   const Objects *obj = &game->obj;
+   const int killer_kind = obj->kind[index];
+   int scan_index = index, victim_candidate = 0, skip_count = 0, i;
+
+   for(i = 1; i <= POPULATION_COUNT * 3; i++)
+   {
+      scan_index++;
+      if( scan_index > POPULATION_COUNT * 3 )
+         scan_index = 1;
+
+      if( obj->state[scan_index] == STATE_LIVE )
+      {
+         if( obj->kind[scan_index] == victim_kind )
+         {
+            victim_candidate = scan_index;
+            if( skip_count == 0 )
+               return scan_index;
+            skip_count--;
+         }
+         else if( obj->kind[scan_index] == killer_kind )
+         {
+            skip_count++;
+         }
+      }
+   }
+   return victim_candidate;
+}
+
+/* Find the same victim as LinearVictimSearch using victim index.
+
+   The scan wraps around, so we first search [index+1, end], and then
+   continue from 1 using the balance carried over from the first part,
+   accepting only positions up to index.  If the balance never drops
+   below zero, the linear scan returns the last victim it has seen, which
+   is the last victim in [1, index] if there is one, otherwise the last
+   victim in [index+1, end].
+
+   Leaves after the last object are always zero, so they never affect
+   the search results.                                                  */
+static int IndexedVictimSearch(const Game *game, int index)
+{
+   const VictimIndex *t = &game->victim_index[game->obj.kind[index]];
+   int balance = 0, victim;
+
+   if( index < POPULATION_COUNT * 3 )
+   {
+      victim = FindFirstVictim(t, index + 1, &balance);
+      if( victim != 0 )
+         return victim;
+   }
+   victim = FindFirstVictim(t, 1, &balance);
+   if( victim != 0 && victim <= index )
+      return victim;
+   victim = FindLastVictim(t, index);
+   if( victim != 0 )
+      return victim;
+   return FindLastVictim(t, POPULATION_COUNT * 3);
+}
+
+/* Set direction to follow next live victim, same as follow_next_victim. */
+static void FollowNextVictim(Game *game, int index, int victim_kind)
+{
+   Objects *obj = &game->obj;
+   int victim, i;
+   int cell_x, cell_y, next_x, next_y, future_x, future_y;
+   const int *v;
+
+   if( game->live_count[victim_kind] <= 0 )
+      return;
+
+   STATS_ADD(game, STAT_RETARGETS);
+   {
+      TIMER_START(search_start);
+      victim = IndexedVictimSearch(game, index);
+      TIMER_STOP(game, TIMER_VICTIM_SEARCH, search_start);
+   }
+   if( game->check_victims )
+   {
+      i = LinearVictimSearch(game, index, victim_kind);
+      if( i != victim )
+      {
+         fprintf(stderr, "Victim mismatch at step %d, object %d: "
+                 "indexed victim = %d, linear victim = %d\n",
+                 game->game_steps, index, victim, i);
+         exit(EXIT_FAILURE);
+      }
+   }
+
+   /* Check where the victim will be in the next frame. */
+   cell_x = CELL(obj->x[index]);
+   cell_y = CELL(obj->y[index]);
+   v = velocity[victim_kind - 1][obj->a[victim] - 1][obj->frame[victim] - 1];
+   next_x = obj->x[victim] + v[0];
+   next_y = obj->y[victim] + v[1];
+   if( cell_x == CELL(next_x) && cell_y == CELL(next_y) )
+   {
+      obj->ta[index] = ((obj->a[victim] + 15) & 31) + 1;
+      return;
+   }
+
+   /* Check where the victim will be 16 frames in the future. */
+   v = average_velocity[obj->a[victim] - 1];
+   future_x = obj->x[victim] + 16 * v[0];
+   future_y = obj->y[victim] + 16 * v[1];
+   if( cell_x == CELL(future_x) && cell_y == CELL(future_y) )
+   {
+      obj->ta[index] = ((obj->a[victim] + 15) & 31) + 1;
+      return;
+   }
+
+   /* Set target angle to arrive at where the victim will be. */
+   obj->ta[index] = GetDirection(future_x - obj->x[index],
+                                 future_y - obj->y[index]);
+   if( obj->ta[index] == obj->a[victim] )
+   {
+      obj->ta[index] = GetDirection(next_x - obj->x[index],
+                                    next_y - obj->y[index]);
+   }
+}
+
+/* Mark an object as having been killed by another, same as kill_obj. */
+static void KillObj(Game *game, int index, int killer)
+{
+   Objects *obj = &game->obj;
+
+   if( obj->state[index] != STATE_LIVE )
+      return;
+
+   SetOccupant(game, obj->x[index], obj->y[index], 0);
+   obj->state[index] = STATE_DYING;
+   obj->frame[index] = 1;
+   obj->ta[index] = obj->a[index];
+   obj->ka[index] = obj->a[killer];
+   game->live_count[obj->kind[index]]--;
+   UpdateVictimIndex(game, index);
+   STATS_ADD(game, STAT_KILLS);
+}
+
+/* Probabilistically remove a wall tile, same as remove_wall_tile.  Only
+   the collision_table update is reproduced here.                      */
+static void RemoveWallTile(Game *game, int tx, int ty)
+{
+   if( tx < GAME_AREA_MIN_X || tx > GAME_AREA_MAX_X ||
+       ty < GAME_AREA_MIN_Y || ty > GAME_AREA_MAX_Y )
+   {
+      return;
+   }
+   STATS_ADD(game, STAT_WALL_BREAK_ATTEMPTS);
+   if( Random1(&game->random, 0x30000) > 0x10000 )
+      return;
+   game->collision_table[GRID_INDEX(tx, ty)] = 0;
+   STATS_ADD(game, STAT_WALL_BREAKS);
+}
+
+/* Handle collision with a single cell.  Returns 1 if cell is an
+   obstacle.                                                      */
+static int CheckCell(Game *game, int index, int victim_kind,
+                     int c, int tx, int ty)
+{
+   STATS_ADD(game, STAT_COLLISION_CHECKS);
+   if( c == 0 )
+      return 0;
+   if( c != WALL_CELL )
+   {
+      if( game->obj.kind[c] == victim_kind )
+      {
+         KillObj(game, c, index);
+         return 0;
+      }
+      return 1;
+   }
+   RemoveWallTile(game, tx, ty);
+   return 1;
+}
+
+/* Update all states for a single object, same as update_obj for an
+   auto-controlled object.                                          */
+static void UpdateObj(Game *game, int index)
+{
+   Objects *obj = &game->obj;
+   const int kind = obj->kind[index];
+   const int victim_kind = (kind + 1) % 3 + 1;
+   int cell_x, cell_y, new_x, new_y, new_cell_x, new_cell_y;
+   int c00, c01, c10, c11, hit_obstacle;
+   uint16_t *ct, *nct;
+   const int *v;
+
+   if( obj->state[index] == STATE_DEAD )
+      return;
+
+   /* Update dying animation. */
+   if( obj->state[index] == STATE_DYING )
+   {
+      obj->frame[index]++;
+      if( obj->frame[index] == 24 )
+         obj->state[index] = STATE_DEAD;
+      return;
+   }
+
+   cell_x = CELL(obj->x[index]);
+   cell_y = CELL(obj->y[index]);
+
+   /* Converge on desired target angle and animate object. */
+   obj->a[index] = converge_angle[obj->a[index] - 1][obj->ta[index] - 1];
+   obj->frame[index] = (obj->frame[index] & 15) + 1;
+
+   /* Don't move if currently stunned. */
+   if( obj->stun[index] > 0 )
+   {
+      obj->stun[index]--;
+      game->debug_count_same_cell++;
+      return;
+   }
+
+   /* Update velocity and compute new location. */
+   v = velocity[kind - 1][obj->a[index] - 1][obj->frame[index] - 1];
+   new_x = obj->x[index] + v[0];
+   new_y = obj->y[index] + v[1];
+
+   /* Recompute target angle based on frame counter. */
+   if( ((obj->frame[index] - 1) & game->action_frame_mask) == 0 )
+   {
+      if( Random1(&game->random, POPULATION_COUNT) >
+          game->live_count[victim_kind] + game->live_count[kind] )
+      {
+         FollowNextVictim(game, index, victim_kind);
+      }
+   }
+   new_cell_x = CELL(new_x);
+   new_cell_y = CELL(new_y);
+
+   /* Nothing else to do if object stays on the same cell. */
+   if( cell_x == new_cell_x && cell_y == new_cell_y )
+   {
+      obj->x[index] = new_x;
+      obj->y[index] = new_y;
+      game->debug_count_same_cell++;
+      return;
+   }
+
+   /* Unmark current collision cells. */
+   STATS_ADD(game, STAT_MOVES);
+   ct = game->collision_table + GRID_INDEX(cell_x, cell_y);
+   ct[0] = ct[1] = ct[GRID_STRIDE] = ct[GRID_STRIDE + 1] = 0;
+
+   /* Check for existing object at destination. */
+   nct = game->collision_table + GRID_INDEX(new_cell_x, new_cell_y);
+   c00 = nct[0];
+   c01 = nct[1];
+   c10 = nct[GRID_STRIDE];
+   c11 = nct[GRID_STRIDE + 1];
+
+   hit_obstacle =
+      CheckCell(game, index, victim_kind, c00, new_cell_x, new_cell_y);
+   hit_obstacle |=
+      CheckCell(game, index, victim_kind, c01, new_cell_x + 1, new_cell_y);
+   hit_obstacle |=
+      CheckCell(game, index, victim_kind, c10, new_cell_x, new_cell_y + 1);
+   hit_obstacle |=
+      CheckCell(game, index, victim_kind, c11,
+                new_cell_x + 1, new_cell_y + 1);
+
+   if( hit_obstacle )
+   {
+      /* Roll back to the previous location, pick a new direction, and
+         stun the object for a few frames.                              */
+      obj->ta[index] =
+         ((obj->ta[index] + RandomRange(&game->random, -8, 8)) & 31) + 1;
+      ct[0] = ct[1] = ct[GRID_STRIDE] = ct[GRID_STRIDE + 1] = index;
+      game->debug_count_collision++;
+      STATS_ADD(game, STAT_COLLISIONS);
+      obj->stun[index] = 4;
+   }
+   else
+   {
+      obj->x[index] = new_x;
+      obj->y[index] = new_y;
+      nct[0] = nct[1] = nct[GRID_STRIDE] = nct[GRID_STRIDE + 1] = index;
+      game->debug_count_no_collision++;
+   }
+}
+
+/* Update one of the slime objects, same as update_slime. */
+static void UpdateSlime(Game *game, int index)
+{
+   Objects *obj = &game->obj;
+   const int cell_x = CELL(obj->x[index]);
+   const int cell_y = CELL(obj->y[index]);
+   int new_x, new_y, new_cell_x, new_cell_y;
+   uint16_t *ct, *nct;
+
+   obj->a[index] = converge_angle[obj->a[index] - 1][obj->ta[index] - 1];
+   obj->frame[index] = (obj->frame[index] & 15) + 1;
+   if( obj->stun[index] > 0 )
+   {
+      obj->stun[index]--;
+      return;
+   }
+
+   new_x = obj->x[index] + slime_velocity[obj->a[index] - 1][0];
+   new_y = obj->y[index] + slime_velocity[obj->a[index] - 1][1];
+   new_cell_x = CELL(new_x);
+   new_cell_y = CELL(new_y);
+   if( cell_x == new_cell_x && cell_y == new_cell_y )
+   {
+      obj->x[index] = new_x;
+      obj->y[index] = new_y;
+      return;
+   }
+
+   STATS_ADD(game, STAT_MOVES);
+   ct = game->collision_table + GRID_INDEX(cell_x, cell_y);
+   ct[0] = ct[1] = ct[GRID_STRIDE] = ct[GRID_STRIDE + 1] = 0;
+
+   nct = game->collision_table + GRID_INDEX(new_cell_x, new_cell_y);
+   if( !IsEmpty(nct) )
+   {
+      STATS_ADD(game, STAT_COLLISIONS);
+      obj->ta[index] =
+         ((obj->ta[index] + RandomRange(&game->random, -8, 8)) & 31) + 1;
+      ct[0] = ct[1] = ct[GRID_STRIDE] = ct[GRID_STRIDE + 1] = index;
+      obj->stun[index] = 8;
+   }
+   else
+   {
+      obj->x[index] = new_x;
+      obj->y[index] = new_y;
+      nct[0] = nct[1] = nct[GRID_STRIDE] = nct[GRID_STRIDE + 1] = index;
+   }
+}
+
+/* Add a dead object back to active list, keeping the list sorted. */
+static void ActivateObj(Game *game, int index)
+{
+   int i;
+
+   for(i = game->active_count; i > 0 && game->active[i - 1] > index; i--)
+      game->active[i] = game->active[i - 1];
+   game->active[i] = (uint16_t)index;
+   game->active_count++;
+}
+
+/* Respawn a single extinct victim if the right object kind lands on
+   the respawn area, same as maybe_respawn.                          */
+static void MaybeRespawn(Game *game)
+{
+   Objects *obj = &game->obj;
+   int respawn_kind, trigger_kind, x, y, step, i, j, offset, v;
+   int cell_x, cell_y;
+
+   if( LiveKindCount(game) != 2 )
+      return;
+
+   if( game->live_count[KIND_ROCK] == 0 )
+   {
+      trigger_kind = KIND_PAPER;
+      respawn_kind = KIND_ROCK;
+   }
+   else if( game->live_count[KIND_PAPER] == 0 )
+   {
+      trigger_kind = KIND_SCISSORS;
+      respawn_kind = KIND_PAPER;
+   }
+   else
+   {
+      trigger_kind = KIND_ROCK;
+      respawn_kind = KIND_SCISSORS;
+   }
+
+   for(y = 0; y <= 5; y++)
+   {
+      /* Only check the cells along the border of the 6x6 area. */
+      step = (y == 0 || y == 5) ? 1 : 5;
+      for(x = 0; x <= 5; x += step)
+      {
+         i = game->collision_table[GRID_INDEX(game->respawn_x + x,
+                                              game->respawn_y + y)];
+         if( i == 0 || i == WALL_CELL || obj->kind[i] != trigger_kind )
+            continue;
+
+         /* Find an object that died outside of the visible area, and
+            currently doesn't have some other object on top of it.  View
+            is always at (0,0), so view_cell_x and view_cell_y are zero. */
+         offset = Random1(&game->random, POPULATION_COUNT) - 1;
+         for(j = 0; j < POPULATION_COUNT; j++)
+         {
+            v = (j + offset) % POPULATION_COUNT * 3 + respawn_kind;
+            cell_x = CELL(obj->x[v]);
+            cell_y = CELL(obj->y[v]);
+            if( (cell_x < -26 || cell_x > 26 ||
+                 cell_y < -16 || cell_y > 16) &&
+                IsEmpty(game->collision_table + GRID_INDEX(cell_x, cell_y)) )
+            {
+               if( game->verbose )
+               {
+                  DebugLog(game, "respawned %d at (%d,%d) [%d,%d]",
+                           v, obj->x[v], obj->y[v], cell_x, cell_y);
+               }
+               /* Respawned object might still be in its dying animation,
+                  in which case it's already in the active list.        */
+               if( obj->state[v] == STATE_DEAD )
+                  ActivateObj(game, v);
+               obj->state[v] = STATE_LIVE;
+               obj->frame[v] = RandomRange(&game->random, 1, 16);
+               SetOccupant(game, obj->x[v], obj->y[v], v);
+               game->live_count[respawn_kind] = 1;
+               UpdateVictimIndex(game, v);
+               STATS_ADD(game, STAT_RESPAWNS);
+               return;
+            }
+         }
+      }
+   }
+}
+
+/* Log debug counters, same as debug_count_report. */
+static void DebugCountReport(Game *game)
+{
+   if( game->verbose )
+   {
+      DebugLog(game, "same_cell=%d, no_collision=%d, collision=%d",
+               game->debug_count_same_cell,
+               game->debug_count_no_collision,
+               game->debug_count_collision);
+   }
+}
+
+/* Update all objects, same as run_simulation_step.
+
+   Only objects in the active list are visited.  Objects that finished
+   their dying animation in this step are dropped from the list as we
+   go, which preserves the update order.  Objects killed during this
+   step are still dying, so they stay in the list until later.        */
+static void RunSimulationStep(Game *game)
+{
+   int i, j, k;
+   TIMER_START(step_start);
+
+   {
+      TIMER_START(update_obj_start);
+      for(i = j = 0; i < game->active_count; i++)
+      {
+         k = game->active[i];
+         UpdateObj(game, k);
+         if( game->obj.state[k] != STATE_DEAD )
+            game->active[j++] = (uint16_t)k;
+      }
+      game->active_count = j;
+      TIMER_STOP(game, TIMER_UPDATE_OBJ, update_obj_start);
+   }
+   {
+      TIMER_START(update_slime_start);
+      for(i = POPULATION_COUNT * 3 + 1; i <= OBJECT_COUNT; i++)
+         UpdateSlime(game, i);
+      TIMER_STOP(game, TIMER_UPDATE_SLIME, update_slime_start);
+   }
+   {
+      TIMER_START(respawn_start);
+      MaybeRespawn(game);
+      TIMER_STOP(game, TIMER_RESPAWN, respawn_start);
+   }
+   STATS_ADD(game, STAT_STEPS);
+
+   game->game_steps++;
+   if( game->game_steps == 450 )
+   {
+      game->action_frame_mask = 7;
+      DebugCountReport(game);
+   }
+   else if( game->game_steps == 900 )
+   {
+      game->action_frame_mask = 3;
+      DebugCountReport(game);
+   }
+   else if( game->game_steps == 1350 )
+   {
+      game->action_frame_mask = 1;
+      DebugCountReport(game);
+   }
+   TIMER_STOP(game, TIMER_STEP, step_start);
+}
+
+/* Run a complete game, same as simulate_game. */
+static void SimulateGame(Game *game, int seed, GameResult *result)
+{
+   int steps = 0;
+
+   DebugLog(game, "simulate_game(%d)", seed);
+   SeedRandom(&game->random, seed);
+   InitWorldPositions(game);
+   {
+      TIMER_START(init_start);
+      InitWorld(game);
+      TIMER_STOP(game, TIMER_INIT, init_start);
+   }
+   STATS_ADD(game, STAT_GAMES);
+   do
+   {
+      RunSimulationStep(game);
+      steps++;
+   } while( LiveKindCount(game) != 1 );
+
+   result->winner = game->live_count[KIND_ROCK] > 0 ? KIND_ROCK :
+                    game->live_count[KIND_PAPER] > 0 ? KIND_PAPER
+                                                     : KIND_SCISSORS;
+   result->steps = steps;
+   DebugLog(game, "%s wins, steps = %d", kind_names[result->winner],
+            steps);
+}
+
+/* }}} */
+
+/* Thread entry point: run games until all games are done. */
+static void *SimulateGames(void *arg)
+{
+   Batch *batch = (Batch*)arg;
+   Game *game;
+   int i;
+
+   game = (Game*)calloc(1, sizeof(Game));
+   if( game == NULL )
+   {
+      fputs("Out of memory\n", stderr);
+      exit(EXIT_FAILURE);
+   }
+   game->verbose = batch->verbose;
+   game->check_victims = batch->check_victims;
+
+   while( (i = atomic_fetch_add(&batch->next_game, 1)) < batch->game_count )
+   {
+      if( batch->logs != NULL )
+      {
+         game->log = batch->logs[i];
+         SimulateGame(game, batch->first_seed + i, &batch->results[i]);
+         batch->logs[i] = game->log;
+      }
+      else
+      {
+         /* Reuse the same buffer for discarded messages. */
+         game->log.size = 0;
+         SimulateGame(game, batch->first_seed + i, &batch->results[i]);
+      }
+   }
+   if( batch->logs == NULL )
+      free(game->log.text);
+
+   #ifdef SIMULATE_GAME_STATS
+      pthread_mutex_lock(&batch->stats_lock);
+      for(i = 0; i < STAT_COUNT; i++)
+         batch->stats.count[i] += game->stats.count[i];
+      for(i = 0; i < TIMER_COUNT; i++)
+         batch->stats.time[i] += game->stats.time[i];
+      pthread_mutex_unlock(&batch->stats_lock);
+   #endif
+   free(game);
+   return NULL;
+}
+
+#ifdef SIMULATE_GAME_STATS
+/* Write instrumentation totals as CSV.  Timers are reported as totals
+   and as averages per step.                                          */
+static void WriteStats(const Stats *stats)
+{
+   const uint64_t steps = stats->count[STAT_STEPS];
+   int i;
+
+   fputs("key,value\n", stderr);
+   for(i = 0; i < STAT_COUNT; i++)
+   {
+      fprintf(stderr, "%s,%llu\n",
+              stat_names[i], (unsigned long long)stats->count[i]);
+   }
+   for(i = 0; i < TIMER_COUNT; i++)
+   {
+      fprintf(stderr, "%s_time,%llu\n",
+              timer_names[i], (unsigned long long)stats->time[i]);
+      fprintf(stderr, "%s_time_per_step,%f\n",
+              timer_names[i],
+              steps > 0 ? (double)stats->time[i] / steps : 0.0);
+   }
+}
+#endif
+
+/* Write summary of game results as CSV. */
+static void WriteSummary(const Batch *batch, int thread_count,
+                         double seconds)
+{
+   int wins[4] = {0, 0, 0, 0};
+   int *histogram;
+   int min_steps, max_steps, bucket_count, i, k;
+   double total_steps = 0;
+
+   min_steps = max_steps = batch->results[0].steps;
+   for(i = 0; i < batch->game_count; i++)
+   {
+      wins[batch->results[i].winner]++;
+      total_steps += batch->results[i].steps;
+      if( min_steps > batch->results[i].steps )
+         min_steps = batch->results[i].steps;
+      if( max_steps < batch->results[i].steps )
+         max_steps = batch->results[i].steps;
+   }
+   bucket_count = max_steps / STEP_HISTOGRAM_BUCKET + 1;
+   histogram = (int*)calloc(bucket_count, sizeof(int));
+   if( histogram == NULL )
+   {
+      fputs("Out of memory\n", stderr);
+      exit(EXIT_FAILURE);
+   }
+   for(i = 0; i < batch->game_count; i++)
+      histogram[batch->results[i].steps / STEP_HISTOGRAM_BUCKET]++;
+
+   printf("key,value\n"
+          "games,%d\n"
+          "first_seed,%d\n"
+          "threads,%d\n"
+          "seconds,%f\n"
+          "games_per_second,%f\n",
+          batch->game_count, batch->first_seed, thread_count, seconds,
+          seconds > 0 ? batch->game_count / seconds : 0.0);
+   for(k = KIND_ROCK; k <= KIND_SCISSORS; k++)
+      printf("%s_wins,%d\n", kind_names[k], wins[k]);
+   for(k = KIND_ROCK; k <= KIND_SCISSORS; k++)
+   {
+      printf("%s_win_rate,%f\n",
+             kind_names[k], (double)wins[k] / batch->game_count);
+   }
+   printf("min_steps,%d\n"
+          "max_steps,%d\n"
+          "average_steps,%f\n",
+          min_steps, max_steps, total_steps / batch->game_count);
+   for(i = 0; i < bucket_count; i++)
+   {
+      printf("steps_%d_%d,%d\n",
+             i * STEP_HISTOGRAM_BUCKET,
+             (i + 1) * STEP_HISTOGRAM_BUCKET - 1,
+             histogram[i]);
+   }
+   free(histogram);
+}
+
+int main(int argc, char **argv)
+{
+   pthread_t threads[MAX_THREADS];
+   int started[MAX_THREADS];
+   struct timespec end_time;
+   Batch batch;
+   int thread_count, summary, last_seed, arg, i;
+
+   memset(&batch, 0, sizeof(batch));
+   thread_count = 1;
+   summary = 0;
+   batch.first_seed = 1;
+   for(arg = 1; arg < argc && argv[arg][0] == '-'; arg++)
+   {
+      if( strcmp(argv[arg], "-v") == 0 )
+      {
+         batch.verbose = 1;
+      }
+      else if( strcmp(argv[arg], "-c") == 0 )
+      {
+         batch.check_victims = 1;
+      }
+      else if( (strcmp(argv[arg], "-j") == 0 ||
+                strcmp(argv[arg], "--threads") == 0) && arg + 1 < argc )
+      {
+         thread_count = atoi(argv[++arg]);
+         if( thread_count < 1 || thread_count > MAX_THREADS )
+         {
+            fprintf(stderr, "Invalid thread count: %s\n", argv[arg]);
+            return 1;
+         }
+      }
+      else if( strcmp(argv[arg], "--games") == 0 && arg + 1 < argc )
+      {
+         summary = 1;
+         batch.game_count = atoi(argv[++arg]);
+         if( batch.game_count < 1 )
+         {
+            fprintf(stderr, "Invalid game count: %s\n", argv[arg]);
+            return 1;
+         }
+      }
+      else if( strcmp(argv[arg], "--seed") == 0 && arg + 1 < argc )
+      {
+         batch.first_seed = atoi(argv[++arg]);
+      }
+      else
+      {
+         break;
+      }
+   }
+   if( arg + (summary ? 0 : 2) != argc )
+   {
+      printf("%s [-v] [-c] [-j {threads}] {first_seed} {last_seed}\n"
+             "%s [-c] [--threads {threads}] [--seed {first_seed}] "
+             "--games {count}\n",
+             *argv, *argv);
+      return 1;
+   }
+   if( !summary )
+   {
+      batch.first_seed = atoi(argv[arg]);
+      last_seed = atoi(argv[arg + 1]);
+      if( last_seed < batch.first_seed )
+      {
+         fprintf(stderr, "Invalid seed range: %d..%d\n",
+                 batch.first_seed, last_seed);
+         return 1;
+      }
+      batch.game_count = last_seed - batch.first_seed + 1;
+      batch.logs = (Log*)calloc(batch.game_count, sizeof(Log));
+      if( batch.logs == NULL )
+         return puts("Out of memory");
+   }
+   batch.results = (GameResult*)calloc(batch.game_count, sizeof(GameResult));
+   if( batch.results == NULL )
+      return puts("Out of memory");
+   atomic_init(&batch.next_game, 0);
+   pthread_mutex_init(&batch.stats_lock, NULL);
+
+   clock_gettime(CLOCK_MONOTONIC, &start_time);
+   for(i = 1; i < thread_count; i++)
+   {
+      started[i] =
+         pthread_create(&threads[i], NULL, SimulateGames, &batch) == 0;
+   }
+   SimulateGames(&batch);
+   for(i = 1; i < thread_count; i++)
+   {
+      if( started[i] )
+         pthread_join(threads[i], NULL);
+   }
+   clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+   if( summary )
+   {
+      WriteSummary(&batch, thread_count,
+                   (double)(end_time.tv_sec - start_time.tv_sec) +
+                   (end_time.tv_nsec - start_time.tv_nsec) / 1e9);
+   }
+   else
+   {
+      for(i = 0; i < batch.game_count; i++)
+      {
+         if( batch.logs[i].text != NULL )
+            fputs(batch.logs[i].text, stdout);
+         free(batch.logs[i].text);
+      }
+      free(batch.logs);
+   }
+   free(batch.results);
+
+   #ifdef SIMULATE_GAME_STATS
+      WriteStats(&batch.stats);
+   #endif
+   pthread_mutex_destroy(&batch.stats_lock);
+   return 0;
+}
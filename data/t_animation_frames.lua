@@ -0,0 +1,1360 @@
+animation_frame =
+{
+	-- KIND_ROCK
+	{
+		-- STATE_DYING (sprites1-table-32-32.png)
+		{
+			{1025, 1057, 1089, 1121, 1153, 1185, 1217, 1249, 1281, 1313, 1345, 1377, 1409, 1441, 1473, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505},
+			{1026, 1058, 1090, 1122, 1154, 1186, 1218, 1250, 1282, 1314, 1346, 1378, 1410, 1442, 1474, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506},
+			{1027, 1059, 1091, 1123, 1155, 1187, 1219, 1251, 1283, 1315, 1347, 1379, 1411, 1443, 1475, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507},
+			{1028, 1060, 1092, 1124, 1156, 1188, 1220, 1252, 1284, 1316, 1348, 1380, 1412, 1444, 1476, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508, 1508},
+			{1029, 1061, 1093, 1125, 1157, 1189, 1221, 1253, 1285, 1317, 1349, 1381, 1413, 1445, 1477, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509},
+			{1030, 1062, 1094, 1126, 1158, 1190, 1222, 1254, 1286, 1318, 1350, 1382, 1414, 1446, 1478, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510},
+			{1031, 1063, 1095, 1127, 1159, 1191, 1223, 1255, 1287, 1319, 1351, 1383, 1415, 1447, 1479, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511, 1511},
+			{1032, 1064, 1096, 1128, 1160, 1192, 1224, 1256, 1288, 1320, 1352, 1384, 1416, 1448, 1480, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512, 1512},
+			{1033, 1065, 1097, 1129, 1161, 1193, 1225, 1257, 1289, 1321, 1353, 1385, 1417, 1449, 1481, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513},
+			{1034, 1066, 1098, 1130, 1162, 1194, 1226, 1258, 1290, 1322, 1354, 1386, 1418, 1450, 1482, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514},
+			{1035, 1067, 1099, 1131, 1163, 1195, 1227, 1259, 1291, 1323, 1355, 1387, 1419, 1451, 1483, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515},
+			{1036, 1068, 1100, 1132, 1164, 1196, 1228, 1260, 1292, 1324, 1356, 1388, 1420, 1452, 1484, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516},
+			{1037, 1069, 1101, 1133, 1165, 1197, 1229, 1261, 1293, 1325, 1357, 1389, 1421, 1453, 1485, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517},
+			{1038, 1070, 1102, 1134, 1166, 1198, 1230, 1262, 1294, 1326, 1358, 1390, 1422, 1454, 1486, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518},
+			{1039, 1071, 1103, 1135, 1167, 1199, 1231, 1263, 1295, 1327, 1359, 1391, 1423, 1455, 1487, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519},
+			{1040, 1072, 1104, 1136, 1168, 1200, 1232, 1264, 1296, 1328, 1360, 1392, 1424, 1456, 1488, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520},
+			{1041, 1073, 1105, 1137, 1169, 1201, 1233, 1265, 1297, 1329, 1361, 1393, 1425, 1457, 1489, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521},
+			{1042, 1074, 1106, 1138, 1170, 1202, 1234, 1266, 1298, 1330, 1362, 1394, 1426, 1458, 1490, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522},
+			{1043, 1075, 1107, 1139, 1171, 1203, 1235, 1267, 1299, 1331, 1363, 1395, 1427, 1459, 1491, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523},
+			{1044, 1076, 1108, 1140, 1172, 1204, 1236, 1268, 1300, 1332, 1364, 1396, 1428, 1460, 1492, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524, 1524},
+			{1045, 1077, 1109, 1141, 1173, 1205, 1237, 1269, 1301, 1333, 1365, 1397, 1429, 1461, 1493, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525},
+			{1046, 1078, 1110, 1142, 1174, 1206, 1238, 1270, 1302, 1334, 1366, 1398, 1430, 1462, 1494, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526},
+			{1047, 1079, 1111, 1143, 1175, 1207, 1239, 1271, 1303, 1335, 1367, 1399, 1431, 1463, 1495, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527},
+			{1048, 1080, 1112, 1144, 1176, 1208, 1240, 1272, 1304, 1336, 1368, 1400, 1432, 1464, 1496, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528},
+			{1049, 1081, 1113, 1145, 1177, 1209, 1241, 1273, 1305, 1337, 1369, 1401, 1433, 1465, 1497, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529},
+			{1050, 1082, 1114, 1146, 1178, 1210, 1242, 1274, 1306, 1338, 1370, 1402, 1434, 1466, 1498, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530},
+			{1051, 1083, 1115, 1147, 1179, 1211, 1243, 1275, 1307, 1339, 1371, 1403, 1435, 1467, 1499, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531},
+			{1052, 1084, 1116, 1148, 1180, 1212, 1244, 1276, 1308, 1340, 1372, 1404, 1436, 1468, 1500, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1532},
+			{1053, 1085, 1117, 1149, 1181, 1213, 1245, 1277, 1309, 1341, 1373, 1405, 1437, 1469, 1501, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533},
+			{1054, 1086, 1118, 1150, 1182, 1214, 1246, 1278, 1310, 1342, 1374, 1406, 1438, 1470, 1502, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534},
+			{1055, 1087, 1119, 1151, 1183, 1215, 1247, 1279, 1311, 1343, 1375, 1407, 1439, 1471, 1503, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535, 1535},
+			{1056, 1088, 1120, 1152, 1184, 1216, 1248, 1280, 1312, 1344, 1376, 1408, 1440, 1472, 1504, 1536, 1536, 1536, 1536, 1536, 1536, 1536, 1536, 1536},
+		},
+		-- STATE_LIVE (sprites1-table-32-32.png)
+		{
+			{513, 545, 577, 609, 641, 673, 705, 737, 769, 801, 833, 865, 897, 929, 961, 993},
+			{514, 546, 578, 610, 642, 674, 706, 738, 770, 802, 834, 866, 898, 930, 962, 994},
+			{515, 547, 579, 611, 643, 675, 707, 739, 771, 803, 835, 867, 899, 931, 963, 995},
+			{516, 548, 580, 612, 644, 676, 708, 740, 772, 804, 836, 868, 900, 932, 964, 996},
+			{517, 549, 581, 613, 645, 677, 709, 741, 773, 805, 837, 869, 901, 933, 965, 997},
+			{518, 550, 582, 614, 646, 678, 710, 742, 774, 806, 838, 870, 902, 934, 966, 998},
+			{519, 551, 583, 615, 647, 679, 711, 743, 775, 807, 839, 871, 903, 935, 967, 999},
+			{520, 552, 584, 616, 648, 680, 712, 744, 776, 808, 840, 872, 904, 936, 968, 1000},
+			{521, 553, 585, 617, 649, 681, 713, 745, 777, 809, 841, 873, 905, 937, 969, 1001},
+			{522, 554, 586, 618, 650, 682, 714, 746, 778, 810, 842, 874, 906, 938, 970, 1002},
+			{523, 555, 587, 619, 651, 683, 715, 747, 779, 811, 843, 875, 907, 939, 971, 1003},
+			{524, 556, 588, 620, 652, 684, 716, 748, 780, 812, 844, 876, 908, 940, 972, 1004},
+			{525, 557, 589, 621, 653, 685, 717, 749, 781, 813, 845, 877, 909, 941, 973, 1005},
+			{526, 558, 590, 622, 654, 686, 718, 750, 782, 814, 846, 878, 910, 942, 974, 1006},
+			{527, 559, 591, 623, 655, 687, 719, 751, 783, 815, 847, 879, 911, 943, 975, 1007},
+			{528, 560, 592, 624, 656, 688, 720, 752, 784, 816, 848, 880, 912, 944, 976, 1008},
+			{529, 561, 593, 625, 657, 689, 721, 753, 785, 817, 849, 881, 913, 945, 977, 1009},
+			{530, 562, 594, 626, 658, 690, 722, 754, 786, 818, 850, 882, 914, 946, 978, 1010},
+			{531, 563, 595, 627, 659, 691, 723, 755, 787, 819, 851, 883, 915, 947, 979, 1011},
+			{532, 564, 596, 628, 660, 692, 724, 756, 788, 820, 852, 884, 916, 948, 980, 1012},
+			{533, 565, 597, 629, 661, 693, 725, 757, 789, 821, 853, 885, 917, 949, 981, 1013},
+			{534, 566, 598, 630, 662, 694, 726, 758, 790, 822, 854, 886, 918, 950, 982, 1014},
+			{535, 567, 599, 631, 663, 695, 727, 759, 791, 823, 855, 887, 919, 951, 983, 1015},
+			{536, 568, 600, 632, 664, 696, 728, 760, 792, 824, 856, 888, 920, 952, 984, 1016},
+			{537, 569, 601, 633, 665, 697, 729, 761, 793, 825, 857, 889, 921, 953, 985, 1017},
+			{538, 570, 602, 634, 666, 698, 730, 762, 794, 826, 858, 890, 922, 954, 986, 1018},
+			{539, 571, 603, 635, 667, 699, 731, 763, 795, 827, 859, 891, 923, 955, 987, 1019},
+			{540, 572, 604, 636, 668, 700, 732, 764, 796, 828, 860, 892, 924, 956, 988, 1020},
+			{541, 573, 605, 637, 669, 701, 733, 765, 797, 829, 861, 893, 925, 957, 989, 1021},
+			{542, 574, 606, 638, 670, 702, 734, 766, 798, 830, 862, 894, 926, 958, 990, 1022},
+			{543, 575, 607, 639, 671, 703, 735, 767, 799, 831, 863, 895, 927, 959, 991, 1023},
+			{544, 576, 608, 640, 672, 704, 736, 768, 800, 832, 864, 896, 928, 960, 992, 1024},
+		}
+	},
+	-- KIND_PAPER
+	{
+		-- STATE_DYING
+		{},  -- See paper_frames
+		-- STATE_LIVE (sprites1-table-32-32.png)
+		{
+			{257, 289, 321, 353, 385, 417, 449, 481, 257, 257, 257, 257, 257, 257, 257, 257},
+			{258, 290, 322, 354, 386, 418, 450, 482, 258, 258, 258, 258, 258, 258, 258, 258},
+			{259, 291, 323, 355, 387, 419, 451, 483, 259, 259, 259, 259, 259, 259, 259, 259},
+			{260, 292, 324, 356, 388, 420, 452, 484, 260, 260, 260, 260, 260, 260, 260, 260},
+			{261, 293, 325, 357, 389, 421, 453, 485, 261, 261, 261, 261, 261, 261, 261, 261},
+			{262, 294, 326, 358, 390, 422, 454, 486, 262, 262, 262, 262, 262, 262, 262, 262},
+			{263, 295, 327, 359, 391, 423, 455, 487, 263, 263, 263, 263, 263, 263, 263, 263},
+			{264, 296, 328, 360, 392, 424, 456, 488, 264, 264, 264, 264, 264, 264, 264, 264},
+			{265, 297, 329, 361, 393, 425, 457, 489, 265, 265, 265, 265, 265, 265, 265, 265},
+			{266, 298, 330, 362, 394, 426, 458, 490, 266, 266, 266, 266, 266, 266, 266, 266},
+			{267, 299, 331, 363, 395, 427, 459, 491, 267, 267, 267, 267, 267, 267, 267, 267},
+			{268, 300, 332, 364, 396, 428, 460, 492, 268, 268, 268, 268, 268, 268, 268, 268},
+			{269, 301, 333, 365, 397, 429, 461, 493, 269, 269, 269, 269, 269, 269, 269, 269},
+			{270, 302, 334, 366, 398, 430, 462, 494, 270, 270, 270, 270, 270, 270, 270, 270},
+			{271, 303, 335, 367, 399, 431, 463, 495, 271, 271, 271, 271, 271, 271, 271, 271},
+			{272, 304, 336, 368, 400, 432, 464, 496, 272, 272, 272, 272, 272, 272, 272, 272},
+			{273, 305, 337, 369, 401, 433, 465, 497, 273, 273, 273, 273, 273, 273, 273, 273},
+			{274, 306, 338, 370, 402, 434, 466, 498, 274, 274, 274, 274, 274, 274, 274, 274},
+			{275, 307, 339, 371, 403, 435, 467, 499, 275, 275, 275, 275, 275, 275, 275, 275},
+			{276, 308, 340, 372, 404, 436, 468, 500, 276, 276, 276, 276, 276, 276, 276, 276},
+			{277, 309, 341, 373, 405, 437, 469, 501, 277, 277, 277, 277, 277, 277, 277, 277},
+			{278, 310, 342, 374, 406, 438, 470, 502, 278, 278, 278, 278, 278, 278, 278, 278},
+			{279, 311, 343, 375, 407, 439, 471, 503, 279, 279, 279, 279, 279, 279, 279, 279},
+			{280, 312, 344, 376, 408, 440, 472, 504, 280, 280, 280, 280, 280, 280, 280, 280},
+			{281, 313, 345, 377, 409, 441, 473, 505, 281, 281, 281, 281, 281, 281, 281, 281},
+			{282, 314, 346, 378, 410, 442, 474, 506, 282, 282, 282, 282, 282, 282, 282, 282},
+			{283, 315, 347, 379, 411, 443, 475, 507, 283, 283, 283, 283, 283, 283, 283, 283},
+			{284, 316, 348, 380, 412, 444, 476, 508, 284, 284, 284, 284, 284, 284, 284, 284},
+			{285, 317, 349, 381, 413, 445, 477, 509, 285, 285, 285, 285, 285, 285, 285, 285},
+			{286, 318, 350, 382, 414, 446, 478, 510, 286, 286, 286, 286, 286, 286, 286, 286},
+			{287, 319, 351, 383, 415, 447, 479, 511, 287, 287, 287, 287, 287, 287, 287, 287},
+			{288, 320, 352, 384, 416, 448, 480, 512, 288, 288, 288, 288, 288, 288, 288, 288},
+		}
+	},
+	-- KIND_SCISSORS
+	{
+		-- STATE_DYING (sprites2-table-64-64.png)
+		{
+			{1, 1, 17, 17, 33, 33, 49, 49, 65, 65, 81, 81, 97, 97, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113},
+			{1, 1, 17, 17, 33, 33, 49, 49, 65, 65, 81, 81, 97, 97, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113},
+			{2, 2, 18, 18, 34, 34, 50, 50, 66, 66, 82, 82, 98, 98, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114},
+			{2, 2, 18, 18, 34, 34, 50, 50, 66, 66, 82, 82, 98, 98, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114},
+			{3, 3, 19, 19, 35, 35, 51, 51, 67, 67, 83, 83, 99, 99, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115},
+			{3, 3, 19, 19, 35, 35, 51, 51, 67, 67, 83, 83, 99, 99, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115},
+			{4, 4, 20, 20, 36, 36, 52, 52, 68, 68, 84, 84, 100, 100, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116},
+			{4, 4, 20, 20, 36, 36, 52, 52, 68, 68, 84, 84, 100, 100, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116},
+			{5, 5, 21, 21, 37, 37, 53, 53, 69, 69, 85, 85, 101, 101, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117},
+			{5, 5, 21, 21, 37, 37, 53, 53, 69, 69, 85, 85, 101, 101, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117},
+			{6, 6, 22, 22, 38, 38, 54, 54, 70, 70, 86, 86, 102, 102, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118},
+			{6, 6, 22, 22, 38, 38, 54, 54, 70, 70, 86, 86, 102, 102, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118},
+			{7, 7, 23, 23, 39, 39, 55, 55, 71, 71, 87, 87, 103, 103, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119},
+			{7, 7, 23, 23, 39, 39, 55, 55, 71, 71, 87, 87, 103, 103, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119},
+			{8, 8, 24, 24, 40, 40, 56, 56, 72, 72, 88, 88, 104, 104, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120},
+			{8, 8, 24, 24, 40, 40, 56, 56, 72, 72, 88, 88, 104, 104, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120},
+			{9, 9, 25, 25, 41, 41, 57, 57, 73, 73, 89, 89, 105, 105, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121},
+			{9, 9, 25, 25, 41, 41, 57, 57, 73, 73, 89, 89, 105, 105, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121},
+			{10, 10, 26, 26, 42, 42, 58, 58, 74, 74, 90, 90, 106, 106, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122},
+			{10, 10, 26, 26, 42, 42, 58, 58, 74, 74, 90, 90, 106, 106, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122},
+			{11, 11, 27, 27, 43, 43, 59, 59, 75, 75, 91, 91, 107, 107, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123},
+			{11, 11, 27, 27, 43, 43, 59, 59, 75, 75, 91, 91, 107, 107, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123},
+			{12, 12, 28, 28, 44, 44, 60, 60, 76, 76, 92, 92, 108, 108, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124},
+			{12, 12, 28, 28, 44, 44, 60, 60, 76, 76, 92, 92, 108, 108, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124},
+			{13, 13, 29, 29, 45, 45, 61, 61, 77, 77, 93, 93, 109, 109, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125},
+			{13, 13, 29, 29, 45, 45, 61, 61, 77, 77, 93, 93, 109, 109, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125},
+			{14, 14, 30, 30, 46, 46, 62, 62, 78, 78, 94, 94, 110, 110, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126},
+			{14, 14, 30, 30, 46, 46, 62, 62, 78, 78, 94, 94, 110, 110, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126},
+			{15, 15, 31, 31, 47, 47, 63, 63, 79, 79, 95, 95, 111, 111, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127},
+			{15, 15, 31, 31, 47, 47, 63, 63, 79, 79, 95, 95, 111, 111, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127},
+			{16, 16, 32, 32, 48, 48, 64, 64, 80, 80, 96, 96, 112, 112, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+			{16, 16, 32, 32, 48, 48, 64, 64, 80, 80, 96, 96, 112, 112, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128},
+		},
+		-- STATE_LIVE (sprites1-table-32-32.png)
+		{
+			{225, 193, 161, 129, 97, 65, 33, 1, 33, 65, 97, 129, 161, 193, 225, 225},
+			{226, 194, 162, 130, 98, 66, 34, 2, 34, 66, 98, 130, 162, 194, 226, 226},
+			{227, 195, 163, 131, 99, 67, 35, 3, 35, 67, 99, 131, 163, 195, 227, 227},
+			{228, 196, 164, 132, 100, 68, 36, 4, 36, 68, 100, 132, 164, 196, 228, 228},
+			{229, 197, 165, 133, 101, 69, 37, 5, 37, 69, 101, 133, 165, 197, 229, 229},
+			{230, 198, 166, 134, 102, 70, 38, 6, 38, 70, 102, 134, 166, 198, 230, 230},
+			{231, 199, 167, 135, 103, 71, 39, 7, 39, 71, 103, 135, 167, 199, 231, 231},
+			{232, 200, 168, 136, 104, 72, 40, 8, 40, 72, 104, 136, 168, 200, 232, 232},
+			{233, 201, 169, 137, 105, 73, 41, 9, 41, 73, 105, 137, 169, 201, 233, 233},
+			{234, 202, 170, 138, 106, 74, 42, 10, 42, 74, 106, 138, 170, 202, 234, 234},
+			{235, 203, 171, 139, 107, 75, 43, 11, 43, 75, 107, 139, 171, 203, 235, 235},
+			{236, 204, 172, 140, 108, 76, 44, 12, 44, 76, 108, 140, 172, 204, 236, 236},
+			{237, 205, 173, 141, 109, 77, 45, 13, 45, 77, 109, 141, 173, 205, 237, 237},
+			{238, 206, 174, 142, 110, 78, 46, 14, 46, 78, 110, 142, 174, 206, 238, 238},
+			{239, 207, 175, 143, 111, 79, 47, 15, 47, 79, 111, 143, 175, 207, 239, 239},
+			{240, 208, 176, 144, 112, 80, 48, 16, 48, 80, 112, 144, 176, 208, 240, 240},
+			{241, 209, 177, 145, 113, 81, 49, 17, 49, 81, 113, 145, 177, 209, 241, 241},
+			{242, 210, 178, 146, 114, 82, 50, 18, 50, 82, 114, 146, 178, 210, 242, 242},
+			{243, 211, 179, 147, 115, 83, 51, 19, 51, 83, 115, 147, 179, 211, 243, 243},
+			{244, 212, 180, 148, 116, 84, 52, 20, 52, 84, 116, 148, 180, 212, 244, 244},
+			{245, 213, 181, 149, 117, 85, 53, 21, 53, 85, 117, 149, 181, 213, 245, 245},
+			{246, 214, 182, 150, 118, 86, 54, 22, 54, 86, 118, 150, 182, 214, 246, 246},
+			{247, 215, 183, 151, 119, 87, 55, 23, 55, 87, 119, 151, 183, 215, 247, 247},
+			{248, 216, 184, 152, 120, 88, 56, 24, 56, 88, 120, 152, 184, 216, 248, 248},
+			{249, 217, 185, 153, 121, 89, 57, 25, 57, 89, 121, 153, 185, 217, 249, 249},
+			{250, 218, 186, 154, 122, 90, 58, 26, 58, 90, 122, 154, 186, 218, 250, 250},
+			{251, 219, 187, 155, 123, 91, 59, 27, 59, 91, 123, 155, 187, 219, 251, 251},
+			{252, 220, 188, 156, 124, 92, 60, 28, 60, 92, 124, 156, 188, 220, 252, 252},
+			{253, 221, 189, 157, 125, 93, 61, 29, 61, 93, 125, 157, 189, 221, 253, 253},
+			{254, 222, 190, 158, 126, 94, 62, 30, 62, 94, 126, 158, 190, 222, 254, 254},
+			{255, 223, 191, 159, 127, 95, 63, 31, 63, 95, 127, 159, 191, 223, 255, 255},
+			{256, 224, 192, 160, 128, 96, 64, 32, 64, 96, 128, 160, 192, 224, 256, 256},
+		}
+	},
+	-- KIND_LIGHT_SLIME
+	{
+		-- STATE_DYING
+		{},  -- Slime never dies.
+		-- STATE_LIVE (sprites1-table-32-32.png)
+		{
+			{1537, 1569, 1601, 1633, 1665, 1697, 1729, 1761, 1729, 1697, 1665, 1633, 1601, 1569, 1538, 1539},
+			{1538, 1570, 1602, 1634, 1666, 1698, 1730, 1762, 1730, 1698, 1666, 1634, 1602, 1570, 1539, 1540},
+			{1539, 1571, 1603, 1635, 1667, 1699, 1731, 1763, 1731, 1699, 1667, 1635, 1603, 1571, 1540, 1541},
+			{1540, 1572, 1604, 1636, 1668, 1700, 1732, 1764, 1732, 1700, 1668, 1636, 1604, 1572, 1541, 1542},
+			{1541, 1573, 1605, 1637, 1669, 1701, 1733, 1765, 1733, 1701, 1669, 1637, 1605, 1573, 1542, 1543},
+			{1542, 1574, 1606, 1638, 1670, 1702, 1734, 1766, 1734, 1702, 1670, 1638, 1606, 1574, 1543, 1544},
+			{1543, 1575, 1607, 1639, 1671, 1703, 1735, 1767, 1735, 1703, 1671, 1639, 1607, 1575, 1544, 1545},
+			{1544, 1576, 1608, 1640, 1672, 1704, 1736, 1768, 1736, 1704, 1672, 1640, 1608, 1576, 1545, 1546},
+			{1545, 1577, 1609, 1641, 1673, 1705, 1737, 1769, 1737, 1705, 1673, 1641, 1609, 1577, 1546, 1547},
+			{1546, 1578, 1610, 1642, 1674, 1706, 1738, 1770, 1738, 1706, 1674, 1642, 1610, 1578, 1547, 1548},
+			{1547, 1579, 1611, 1643, 1675, 1707, 1739, 1771, 1739, 1707, 1675, 1643, 1611, 1579, 1548, 1549},
+			{1548, 1580, 1612, 1644, 1676, 1708, 1740, 1772, 1740, 1708, 1676, 1644, 1612, 1580, 1549, 1550},
+			{1549, 1581, 1613, 1645, 1677, 1709, 1741, 1773, 1741, 1709, 1677, 1645, 1613, 1581, 1550, 1551},
+			{1550, 1582, 1614, 1646, 1678, 1710, 1742, 1774, 1742, 1710, 1678, 1646, 1614, 1582, 1551, 1552},
+			{1551, 1583, 1615, 1647, 1679, 1711, 1743, 1775, 1743, 1711, 1679, 1647, 1615, 1583, 1552, 1537},
+			{1552, 1584, 1616, 1648, 1680, 1712, 1744, 1776, 1744, 1712, 1680, 1648, 1616, 1584, 1537, 1538},
+			{1537, 1569, 1601, 1633, 1665, 1697, 1729, 1761, 1729, 1697, 1665, 1633, 1601, 1569, 1538, 1539},
+			{1538, 1570, 1602, 1634, 1666, 1698, 1730, 1762, 1730, 1698, 1666, 1634, 1602, 1570, 1539, 1540},
+			{1539, 1571, 1603, 1635, 1667, 1699, 1731, 1763, 1731, 1699, 1667, 1635, 1603, 1571, 1540, 1541},
+			{1540, 1572, 1604, 1636, 1668, 1700, 1732, 1764, 1732, 1700, 1668, 1636, 1604, 1572, 1541, 1542},
+			{1541, 1573, 1605, 1637, 1669, 1701, 1733, 1765, 1733, 1701, 1669, 1637, 1605, 1573, 1542, 1543},
+			{1542, 1574, 1606, 1638, 1670, 1702, 1734, 1766, 1734, 1702, 1670, 1638, 1606, 1574, 1543, 1544},
+			{1543, 1575, 1607, 1639, 1671, 1703, 1735, 1767, 1735, 1703, 1671, 1639, 1607, 1575, 1544, 1545},
+			{1544, 1576, 1608, 1640, 1672, 1704, 1736, 1768, 1736, 1704, 1672, 1640, 1608, 1576, 1545, 1546},
+			{1545, 1577, 1609, 1641, 1673, 1705, 1737, 1769, 1737, 1705, 1673, 1641, 1609, 1577, 1546, 1547},
+			{1546, 1578, 1610, 1642, 1674, 1706, 1738, 1770, 1738, 1706, 1674, 1642, 1610, 1578, 1547, 1548},
+			{1547, 1579, 1611, 1643, 1675, 1707, 1739, 1771, 1739, 1707, 1675, 1643, 1611, 1579, 1548, 1549},
+			{1548, 1580, 1612, 1644, 1676, 1708, 1740, 1772, 1740, 1708, 1676, 1644, 1612, 1580, 1549, 1550},
+			{1549, 1581, 1613, 1645, 1677, 1709, 1741, 1773, 1741, 1709, 1677, 1645, 1613, 1581, 1550, 1551},
+			{1550, 1582, 1614, 1646, 1678, 1710, 1742, 1774, 1742, 1710, 1678, 1646, 1614, 1582, 1551, 1552},
+			{1551, 1583, 1615, 1647, 1679, 1711, 1743, 1775, 1743, 1711, 1679, 1647, 1615, 1583, 1552, 1537},
+			{1552, 1584, 1616, 1648, 1680, 1712, 1744, 1776, 1744, 1712, 1680, 1648, 1616, 1584, 1537, 1538},
+		}
+	},
+	-- KIND_DARK_SLIME
+	{
+		-- STATE_DYING
+		{},  -- Slime never dies.
+		-- STATE_LIVE (sprites1-table-32-32.png)
+		{
+			{1553, 1585, 1617, 1649, 1681, 1713, 1745, 1777, 1745, 1713, 1681, 1649, 1617, 1585, 1553, 1553},
+			{1554, 1586, 1618, 1650, 1682, 1714, 1746, 1778, 1746, 1714, 1682, 1650, 1618, 1586, 1554, 1554},
+			{1555, 1587, 1619, 1651, 1683, 1715, 1747, 1779, 1747, 1715, 1683, 1651, 1619, 1587, 1555, 1555},
+			{1556, 1588, 1620, 1652, 1684, 1716, 1748, 1780, 1748, 1716, 1684, 1652, 1620, 1588, 1556, 1556},
+			{1557, 1589, 1621, 1653, 1685, 1717, 1749, 1781, 1749, 1717, 1685, 1653, 1621, 1589, 1557, 1557},
+			{1558, 1590, 1622, 1654, 1686, 1718, 1750, 1782, 1750, 1718, 1686, 1654, 1622, 1590, 1558, 1558},
+			{1559, 1591, 1623, 1655, 1687, 1719, 1751, 1783, 1751, 1719, 1687, 1655, 1623, 1591, 1559, 1559},
+			{1560, 1592, 1624, 1656, 1688, 1720, 1752, 1784, 1752, 1720, 1688, 1656, 1624, 1592, 1560, 1560},
+			{1561, 1593, 1625, 1657, 1689, 1721, 1753, 1785, 1753, 1721, 1689, 1657, 1625, 1593, 1561, 1561},
+			{1562, 1594, 1626, 1658, 1690, 1722, 1754, 1786, 1754, 1722, 1690, 1658, 1626, 1594, 1562, 1562},
+			{1563, 1595, 1627, 1659, 1691, 1723, 1755, 1787, 1755, 1723, 1691, 1659, 1627, 1595, 1563, 1563},
+			{1564, 1596, 1628, 1660, 1692, 1724, 1756, 1788, 1756, 1724, 1692, 1660, 1628, 1596, 1564, 1564},
+			{1565, 1597, 1629, 1661, 1693, 1725, 1757, 1789, 1757, 1725, 1693, 1661, 1629, 1597, 1565, 1565},
+			{1566, 1598, 1630, 1662, 1694, 1726, 1758, 1790, 1758, 1726, 1694, 1662, 1630, 1598, 1566, 1566},
+			{1567, 1599, 1631, 1663, 1695, 1727, 1759, 1791, 1759, 1727, 1695, 1663, 1631, 1599, 1567, 1567},
+			{1568, 1600, 1632, 1664, 1696, 1728, 1760, 1792, 1760, 1728, 1696, 1664, 1632, 1600, 1568, 1568},
+			{1553, 1585, 1617, 1649, 1681, 1713, 1745, 1777, 1745, 1713, 1681, 1649, 1617, 1585, 1553, 1553},
+			{1554, 1586, 1618, 1650, 1682, 1714, 1746, 1778, 1746, 1714, 1682, 1650, 1618, 1586, 1554, 1554},
+			{1555, 1587, 1619, 1651, 1683, 1715, 1747, 1779, 1747, 1715, 1683, 1651, 1619, 1587, 1555, 1555},
+			{1556, 1588, 1620, 1652, 1684, 1716, 1748, 1780, 1748, 1716, 1684, 1652, 1620, 1588, 1556, 1556},
+			{1557, 1589, 1621, 1653, 1685, 1717, 1749, 1781, 1749, 1717, 1685, 1653, 1621, 1589, 1557, 1557},
+			{1558, 1590, 1622, 1654, 1686, 1718, 1750, 1782, 1750, 1718, 1686, 1654, 1622, 1590, 1558, 1558},
+			{1559, 1591, 1623, 1655, 1687, 1719, 1751, 1783, 1751, 1719, 1687, 1655, 1623, 1591, 1559, 1559},
+			{1560, 1592, 1624, 1656, 1688, 1720, 1752, 1784, 1752, 1720, 1688, 1656, 1624, 1592, 1560, 1560},
+			{1561, 1593, 1625, 1657, 1689, 1721, 1753, 1785, 1753, 1721, 1689, 1657, 1625, 1593, 1561, 1561},
+			{1562, 1594, 1626, 1658, 1690, 1722, 1754, 1786, 1754, 1722, 1690, 1658, 1626, 1594, 1562, 1562},
+			{1563, 1595, 1627, 1659, 1691, 1723, 1755, 1787, 1755, 1723, 1691, 1659, 1627, 1595, 1563, 1563},
+			{1564, 1596, 1628, 1660, 1692, 1724, 1756, 1788, 1756, 1724, 1692, 1660, 1628, 1596, 1564, 1564},
+			{1565, 1597, 1629, 1661, 1693, 1725, 1757, 1789, 1757, 1725, 1693, 1661, 1629, 1597, 1565, 1565},
+			{1566, 1598, 1630, 1662, 1694, 1726, 1758, 1790, 1758, 1726, 1694, 1662, 1630, 1598, 1566, 1566},
+			{1567, 1599, 1631, 1663, 1695, 1727, 1759, 1791, 1759, 1727, 1695, 1663, 1631, 1599, 1567, 1567},
+			{1568, 1600, 1632, 1664, 1696, 1728, 1760, 1792, 1760, 1728, 1696, 1664, 1632, 1600, 1568, 1568},
+		}
+	},
+}
+paper_frames =  -- (sprites2-table-64-64.png)
+{
+	{
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (0, 0)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (0, 1)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (0, 2)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (0, 3)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (0, 4)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (0, 5)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (0, 6)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (0, 7)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (0, 8)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (0, 9)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (0, 10)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (0, 11)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (0, 12)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (0, 13)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (0, 14)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (0, 15)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (0, 16)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (0, 17)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (0, 18)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (0, 19)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (0, 20)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (0, 21)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (0, 22)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (0, 23)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (0, 24)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (0, 25)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (0, 26)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (0, 27)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (0, 28)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (0, 29)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (0, 30)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (0, 31)
+	},
+	{
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (1, 0)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (1, 1)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (1, 2)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (1, 3)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (1, 4)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (1, 5)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (1, 6)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (1, 7)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (1, 8)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (1, 9)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (1, 10)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (1, 11)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (1, 12)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (1, 13)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (1, 14)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (1, 15)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (1, 16)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (1, 17)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (1, 18)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (1, 19)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (1, 20)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (1, 21)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (1, 22)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (1, 23)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (1, 24)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (1, 25)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (1, 26)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (1, 27)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (1, 28)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (1, 29)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (1, 30)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (1, 31)
+	},
+	{
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (2, 0)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (2, 1)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (2, 2)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (2, 3)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (2, 4)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (2, 5)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (2, 6)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (2, 7)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (2, 8)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (2, 9)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (2, 10)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (2, 11)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (2, 12)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (2, 13)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (2, 14)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (2, 15)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (2, 16)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (2, 17)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (2, 18)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (2, 19)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (2, 20)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (2, 21)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (2, 22)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (2, 23)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (2, 24)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (2, 25)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (2, 26)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (2, 27)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (2, 28)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (2, 29)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (2, 30)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (2, 31)
+	},
+	{
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (3, 0)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (3, 1)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (3, 2)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (3, 3)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (3, 4)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (3, 5)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (3, 6)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (3, 7)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (3, 8)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (3, 9)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (3, 10)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (3, 11)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (3, 12)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (3, 13)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (3, 14)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (3, 15)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (3, 16)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (3, 17)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (3, 18)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (3, 19)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (3, 20)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (3, 21)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (3, 22)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (3, 23)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (3, 24)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (3, 25)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (3, 26)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (3, 27)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (3, 28)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (3, 29)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (3, 30)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (3, 31)
+	},
+	{
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (4, 0)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (4, 1)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (4, 2)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (4, 3)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (4, 4)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (4, 5)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (4, 6)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (4, 7)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (4, 8)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (4, 9)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (4, 10)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (4, 11)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (4, 12)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (4, 13)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (4, 14)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (4, 15)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (4, 16)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (4, 17)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (4, 18)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (4, 19)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (4, 20)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (4, 21)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (4, 22)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (4, 23)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (4, 24)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (4, 25)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (4, 26)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (4, 27)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (4, 28)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (4, 29)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (4, 30)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (4, 31)
+	},
+	{
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (5, 0)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (5, 1)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (5, 2)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (5, 3)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (5, 4)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (5, 5)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (5, 6)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (5, 7)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (5, 8)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (5, 9)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (5, 10)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (5, 11)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (5, 12)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (5, 13)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (5, 14)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (5, 15)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (5, 16)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (5, 17)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (5, 18)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (5, 19)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (5, 20)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (5, 21)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (5, 22)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (5, 23)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (5, 24)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (5, 25)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (5, 26)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (5, 27)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (5, 28)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (5, 29)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (5, 30)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (5, 31)
+	},
+	{
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (6, 0)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (6, 1)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (6, 2)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (6, 3)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (6, 4)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (6, 5)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (6, 6)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (6, 7)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (6, 8)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (6, 9)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (6, 10)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (6, 11)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (6, 12)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (6, 13)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (6, 14)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (6, 15)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (6, 16)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (6, 17)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (6, 18)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (6, 19)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (6, 20)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (6, 21)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (6, 22)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (6, 23)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (6, 24)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (6, 25)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (6, 26)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (6, 27)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (6, 28)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (6, 29)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (6, 30)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (6, 31)
+	},
+	{
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (7, 0)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (7, 1)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (7, 2)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (7, 3)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (7, 4)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (7, 5)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (7, 6)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (7, 7)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (7, 8)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (7, 9)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (7, 10)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (7, 11)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (7, 12)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (7, 13)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (7, 14)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (7, 15)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (7, 16)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (7, 17)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (7, 18)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (7, 19)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (7, 20)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (7, 21)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (7, 22)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (7, 23)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (7, 24)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (7, 25)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (7, 26)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (7, 27)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (7, 28)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (7, 29)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (7, 30)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (7, 31)
+	},
+	{
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (8, 0)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (8, 1)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (8, 2)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (8, 3)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (8, 4)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (8, 5)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (8, 6)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (8, 7)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (8, 8)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (8, 9)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (8, 10)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (8, 11)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (8, 12)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (8, 13)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (8, 14)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (8, 15)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (8, 16)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (8, 17)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (8, 18)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (8, 19)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (8, 20)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (8, 21)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (8, 22)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (8, 23)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (8, 24)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (8, 25)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (8, 26)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (8, 27)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (8, 28)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (8, 29)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (8, 30)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (8, 31)
+	},
+	{
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (9, 0)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (9, 1)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (9, 2)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (9, 3)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (9, 4)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (9, 5)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (9, 6)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (9, 7)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (9, 8)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (9, 9)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (9, 10)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (9, 11)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (9, 12)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (9, 13)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (9, 14)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (9, 15)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (9, 16)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (9, 17)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (9, 18)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (9, 19)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (9, 20)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (9, 21)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (9, 22)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (9, 23)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (9, 24)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (9, 25)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (9, 26)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (9, 27)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (9, 28)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (9, 29)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (9, 30)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (9, 31)
+	},
+	{
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (10, 0)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (10, 1)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (10, 2)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (10, 3)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (10, 4)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (10, 5)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (10, 6)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (10, 7)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (10, 8)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (10, 9)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (10, 10)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (10, 11)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (10, 12)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (10, 13)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (10, 14)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (10, 15)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (10, 16)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (10, 17)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (10, 18)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (10, 19)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (10, 20)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (10, 21)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (10, 22)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (10, 23)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (10, 24)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (10, 25)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (10, 26)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (10, 27)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (10, 28)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (10, 29)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (10, 30)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (10, 31)
+	},
+	{
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (11, 0)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (11, 1)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (11, 2)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (11, 3)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (11, 4)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (11, 5)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (11, 6)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (11, 7)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (11, 8)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (11, 9)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (11, 10)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (11, 11)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (11, 12)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (11, 13)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (11, 14)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (11, 15)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (11, 16)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (11, 17)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (11, 18)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (11, 19)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (11, 20)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (11, 21)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (11, 22)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (11, 23)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (11, 24)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (11, 25)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (11, 26)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (11, 27)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (11, 28)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (11, 29)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (11, 30)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (11, 31)
+	},
+	{
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (12, 0)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (12, 1)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (12, 2)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (12, 3)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (12, 4)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (12, 5)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (12, 6)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (12, 7)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (12, 8)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (12, 9)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (12, 10)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (12, 11)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (12, 12)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (12, 13)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (12, 14)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (12, 15)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (12, 16)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (12, 17)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (12, 18)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (12, 19)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (12, 20)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (12, 21)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (12, 22)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (12, 23)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (12, 24)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (12, 25)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (12, 26)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (12, 27)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (12, 28)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (12, 29)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (12, 30)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (12, 31)
+	},
+	{
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (13, 0)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (13, 1)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (13, 2)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (13, 3)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (13, 4)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (13, 5)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (13, 6)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (13, 7)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (13, 8)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (13, 9)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (13, 10)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (13, 11)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (13, 12)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (13, 13)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (13, 14)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (13, 15)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (13, 16)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (13, 17)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (13, 18)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (13, 19)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (13, 20)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (13, 21)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (13, 22)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (13, 23)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (13, 24)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (13, 25)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (13, 26)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (13, 27)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (13, 28)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (13, 29)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (13, 30)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (13, 31)
+	},
+	{
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (14, 0)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (14, 1)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (14, 2)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (14, 3)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (14, 4)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (14, 5)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (14, 6)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (14, 7)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (14, 8)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (14, 9)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (14, 10)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (14, 11)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (14, 12)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (14, 13)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (14, 14)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (14, 15)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (14, 16)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (14, 17)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (14, 18)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (14, 19)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (14, 20)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (14, 21)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (14, 22)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (14, 23)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (14, 24)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (14, 25)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (14, 26)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (14, 27)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (14, 28)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (14, 29)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (14, 30)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (14, 31)
+	},
+	{
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (15, 0)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (15, 1)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (15, 2)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (15, 3)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (15, 4)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (15, 5)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (15, 6)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (15, 7)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (15, 8)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (15, 9)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (15, 10)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (15, 11)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (15, 12)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (15, 13)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (15, 14)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (15, 15)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (15, 16)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (15, 17)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (15, 18)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (15, 19)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (15, 20)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (15, 21)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (15, 22)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (15, 23)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (15, 24)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (15, 25)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (15, 26)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (15, 27)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (15, 28)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (15, 29)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (15, 30)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (15, 31)
+	},
+	{
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (16, 0)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (16, 1)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (16, 2)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (16, 3)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (16, 4)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (16, 5)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (16, 6)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (16, 7)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (16, 8)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (16, 9)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (16, 10)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (16, 11)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (16, 12)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (16, 13)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (16, 14)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (16, 15)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (16, 16)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (16, 17)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (16, 18)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (16, 19)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (16, 20)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (16, 21)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (16, 22)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (16, 23)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (16, 24)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (16, 25)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (16, 26)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (16, 27)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (16, 28)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (16, 29)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (16, 30)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (16, 31)
+	},
+	{
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (17, 0)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (17, 1)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (17, 2)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (17, 3)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (17, 4)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (17, 5)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (17, 6)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (17, 7)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (17, 8)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (17, 9)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (17, 10)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (17, 11)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (17, 12)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (17, 13)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (17, 14)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (17, 15)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (17, 16)
+		{129, 129, 145, 145, 161, 161, 177, 177, 130, 130, 146, 146, 162, 162, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178},  -- (17, 17)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (17, 18)
+		{193, 193, 209, 209, 225, 225, 241, 241, 194, 194, 210, 210, 226, 226, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242},  -- (17, 19)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (17, 20)
+		{257, 257, 273, 273, 289, 289, 305, 305, 258, 258, 274, 274, 290, 290, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306},  -- (17, 21)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (17, 22)
+		{321, 321, 337, 337, 353, 353, 369, 369, 322, 322, 338, 338, 354, 354, 370, 370, 370, 370, 370, 370, 370, 370, 370, 370},  -- (17, 23)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (17, 24)
+		{385, 385, 401, 401, 417, 417, 433, 433, 386, 386, 402, 402, 418, 418, 434, 434, 434, 434, 434, 434, 434, 434, 434, 434},  -- (17, 25)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (17, 26)
+		{449, 449, 465, 465, 481, 481, 497, 497, 450, 450, 466, 466, 482, 482, 498, 498, 498, 498, 498, 498, 498, 498, 498, 498},  -- (17, 27)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (17, 28)
+		{513, 513, 529, 529, 545, 545, 561, 561, 514, 514, 530, 530, 546, 546, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562},  -- (17, 29)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (17, 30)
+		{577, 577, 593, 593, 609, 609, 625, 625, 578, 578, 594, 594, 610, 610, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626},  -- (17, 31)
+	},
+	{
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (18, 0)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (18, 1)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (18, 2)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (18, 3)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (18, 4)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (18, 5)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (18, 6)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (18, 7)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (18, 8)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (18, 9)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (18, 10)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (18, 11)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (18, 12)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (18, 13)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (18, 14)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (18, 15)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (18, 16)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (18, 17)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (18, 18)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (18, 19)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (18, 20)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (18, 21)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (18, 22)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (18, 23)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (18, 24)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (18, 25)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (18, 26)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (18, 27)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (18, 28)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (18, 29)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (18, 30)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (18, 31)
+	},
+	{
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (19, 0)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (19, 1)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (19, 2)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (19, 3)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (19, 4)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (19, 5)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (19, 6)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (19, 7)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (19, 8)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (19, 9)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (19, 10)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (19, 11)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (19, 12)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (19, 13)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (19, 14)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (19, 15)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (19, 16)
+		{131, 131, 147, 147, 163, 163, 179, 179, 132, 132, 148, 148, 164, 164, 180, 180, 180, 180, 180, 180, 180, 180, 180, 180},  -- (19, 17)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (19, 18)
+		{195, 195, 211, 211, 227, 227, 243, 243, 196, 196, 212, 212, 228, 228, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244},  -- (19, 19)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (19, 20)
+		{259, 259, 275, 275, 291, 291, 307, 307, 260, 260, 276, 276, 292, 292, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308},  -- (19, 21)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (19, 22)
+		{323, 323, 339, 339, 355, 355, 371, 371, 324, 324, 340, 340, 356, 356, 372, 372, 372, 372, 372, 372, 372, 372, 372, 372},  -- (19, 23)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (19, 24)
+		{387, 387, 403, 403, 419, 419, 435, 435, 388, 388, 404, 404, 420, 420, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436},  -- (19, 25)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (19, 26)
+		{451, 451, 467, 467, 483, 483, 499, 499, 452, 452, 468, 468, 484, 484, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500},  -- (19, 27)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (19, 28)
+		{515, 515, 531, 531, 547, 547, 563, 563, 516, 516, 532, 532, 548, 548, 564, 564, 564, 564, 564, 564, 564, 564, 564, 564},  -- (19, 29)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (19, 30)
+		{579, 579, 595, 595, 611, 611, 627, 627, 580, 580, 596, 596, 612, 612, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628},  -- (19, 31)
+	},
+	{
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (20, 0)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (20, 1)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (20, 2)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (20, 3)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (20, 4)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (20, 5)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (20, 6)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (20, 7)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (20, 8)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (20, 9)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (20, 10)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (20, 11)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (20, 12)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (20, 13)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (20, 14)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (20, 15)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (20, 16)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (20, 17)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (20, 18)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (20, 19)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (20, 20)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (20, 21)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (20, 22)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (20, 23)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (20, 24)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (20, 25)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (20, 26)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (20, 27)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (20, 28)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (20, 29)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (20, 30)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (20, 31)
+	},
+	{
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (21, 0)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (21, 1)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (21, 2)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (21, 3)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (21, 4)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (21, 5)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (21, 6)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (21, 7)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (21, 8)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (21, 9)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (21, 10)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (21, 11)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (21, 12)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (21, 13)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (21, 14)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (21, 15)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (21, 16)
+		{133, 133, 149, 149, 165, 165, 181, 181, 134, 134, 150, 150, 166, 166, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182},  -- (21, 17)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (21, 18)
+		{197, 197, 213, 213, 229, 229, 245, 245, 198, 198, 214, 214, 230, 230, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246},  -- (21, 19)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (21, 20)
+		{261, 261, 277, 277, 293, 293, 309, 309, 262, 262, 278, 278, 294, 294, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310},  -- (21, 21)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (21, 22)
+		{325, 325, 341, 341, 357, 357, 373, 373, 326, 326, 342, 342, 358, 358, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374},  -- (21, 23)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (21, 24)
+		{389, 389, 405, 405, 421, 421, 437, 437, 390, 390, 406, 406, 422, 422, 438, 438, 438, 438, 438, 438, 438, 438, 438, 438},  -- (21, 25)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (21, 26)
+		{453, 453, 469, 469, 485, 485, 501, 501, 454, 454, 470, 470, 486, 486, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502},  -- (21, 27)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (21, 28)
+		{517, 517, 533, 533, 549, 549, 565, 565, 518, 518, 534, 534, 550, 550, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566},  -- (21, 29)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (21, 30)
+		{581, 581, 597, 597, 613, 613, 629, 629, 582, 582, 598, 598, 614, 614, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630},  -- (21, 31)
+	},
+	{
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (22, 0)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (22, 1)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (22, 2)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (22, 3)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (22, 4)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (22, 5)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (22, 6)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (22, 7)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (22, 8)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (22, 9)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (22, 10)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (22, 11)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (22, 12)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (22, 13)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (22, 14)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (22, 15)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (22, 16)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (22, 17)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (22, 18)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (22, 19)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (22, 20)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (22, 21)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (22, 22)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (22, 23)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (22, 24)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (22, 25)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (22, 26)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (22, 27)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (22, 28)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (22, 29)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (22, 30)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (22, 31)
+	},
+	{
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (23, 0)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (23, 1)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (23, 2)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (23, 3)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (23, 4)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (23, 5)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (23, 6)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (23, 7)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (23, 8)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (23, 9)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (23, 10)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (23, 11)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (23, 12)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (23, 13)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (23, 14)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (23, 15)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (23, 16)
+		{135, 135, 151, 151, 167, 167, 183, 183, 136, 136, 152, 152, 168, 168, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184},  -- (23, 17)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (23, 18)
+		{199, 199, 215, 215, 231, 231, 247, 247, 200, 200, 216, 216, 232, 232, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248},  -- (23, 19)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (23, 20)
+		{263, 263, 279, 279, 295, 295, 311, 311, 264, 264, 280, 280, 296, 296, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312},  -- (23, 21)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (23, 22)
+		{327, 327, 343, 343, 359, 359, 375, 375, 328, 328, 344, 344, 360, 360, 376, 376, 376, 376, 376, 376, 376, 376, 376, 376},  -- (23, 23)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (23, 24)
+		{391, 391, 407, 407, 423, 423, 439, 439, 392, 392, 408, 408, 424, 424, 440, 440, 440, 440, 440, 440, 440, 440, 440, 440},  -- (23, 25)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (23, 26)
+		{455, 455, 471, 471, 487, 487, 503, 503, 456, 456, 472, 472, 488, 488, 504, 504, 504, 504, 504, 504, 504, 504, 504, 504},  -- (23, 27)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (23, 28)
+		{519, 519, 535, 535, 551, 551, 567, 567, 520, 520, 536, 536, 552, 552, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568},  -- (23, 29)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (23, 30)
+		{583, 583, 599, 599, 615, 615, 631, 631, 584, 584, 600, 600, 616, 616, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632},  -- (23, 31)
+	},
+	{
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (24, 0)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (24, 1)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (24, 2)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (24, 3)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (24, 4)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (24, 5)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (24, 6)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (24, 7)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (24, 8)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (24, 9)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (24, 10)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (24, 11)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (24, 12)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (24, 13)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (24, 14)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (24, 15)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (24, 16)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (24, 17)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (24, 18)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (24, 19)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (24, 20)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (24, 21)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (24, 22)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (24, 23)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (24, 24)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (24, 25)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (24, 26)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (24, 27)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (24, 28)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (24, 29)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (24, 30)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (24, 31)
+	},
+	{
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (25, 0)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (25, 1)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (25, 2)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (25, 3)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (25, 4)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (25, 5)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (25, 6)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (25, 7)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (25, 8)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (25, 9)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (25, 10)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (25, 11)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (25, 12)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (25, 13)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (25, 14)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (25, 15)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (25, 16)
+		{137, 137, 153, 153, 169, 169, 185, 185, 138, 138, 154, 154, 170, 170, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186},  -- (25, 17)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (25, 18)
+		{201, 201, 217, 217, 233, 233, 249, 249, 202, 202, 218, 218, 234, 234, 250, 250, 250, 250, 250, 250, 250, 250, 250, 250},  -- (25, 19)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (25, 20)
+		{265, 265, 281, 281, 297, 297, 313, 313, 266, 266, 282, 282, 298, 298, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314},  -- (25, 21)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (25, 22)
+		{329, 329, 345, 345, 361, 361, 377, 377, 330, 330, 346, 346, 362, 362, 378, 378, 378, 378, 378, 378, 378, 378, 378, 378},  -- (25, 23)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (25, 24)
+		{393, 393, 409, 409, 425, 425, 441, 441, 394, 394, 410, 410, 426, 426, 442, 442, 442, 442, 442, 442, 442, 442, 442, 442},  -- (25, 25)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (25, 26)
+		{457, 457, 473, 473, 489, 489, 505, 505, 458, 458, 474, 474, 490, 490, 506, 506, 506, 506, 506, 506, 506, 506, 506, 506},  -- (25, 27)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (25, 28)
+		{521, 521, 537, 537, 553, 553, 569, 569, 522, 522, 538, 538, 554, 554, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570},  -- (25, 29)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (25, 30)
+		{585, 585, 601, 601, 617, 617, 633, 633, 586, 586, 602, 602, 618, 618, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634},  -- (25, 31)
+	},
+	{
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (26, 0)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (26, 1)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (26, 2)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (26, 3)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (26, 4)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (26, 5)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (26, 6)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (26, 7)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (26, 8)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (26, 9)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (26, 10)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (26, 11)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (26, 12)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (26, 13)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (26, 14)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (26, 15)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (26, 16)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (26, 17)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (26, 18)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (26, 19)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (26, 20)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (26, 21)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (26, 22)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (26, 23)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (26, 24)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (26, 25)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (26, 26)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (26, 27)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (26, 28)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (26, 29)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (26, 30)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (26, 31)
+	},
+	{
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (27, 0)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (27, 1)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (27, 2)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (27, 3)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (27, 4)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (27, 5)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (27, 6)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (27, 7)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (27, 8)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (27, 9)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (27, 10)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (27, 11)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (27, 12)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (27, 13)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (27, 14)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (27, 15)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (27, 16)
+		{139, 139, 155, 155, 171, 171, 187, 187, 140, 140, 156, 156, 172, 172, 188, 188, 188, 188, 188, 188, 188, 188, 188, 188},  -- (27, 17)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (27, 18)
+		{203, 203, 219, 219, 235, 235, 251, 251, 204, 204, 220, 220, 236, 236, 252, 252, 252, 252, 252, 252, 252, 252, 252, 252},  -- (27, 19)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (27, 20)
+		{267, 267, 283, 283, 299, 299, 315, 315, 268, 268, 284, 284, 300, 300, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316},  -- (27, 21)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (27, 22)
+		{331, 331, 347, 347, 363, 363, 379, 379, 332, 332, 348, 348, 364, 364, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380},  -- (27, 23)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (27, 24)
+		{395, 395, 411, 411, 427, 427, 443, 443, 396, 396, 412, 412, 428, 428, 444, 444, 444, 444, 444, 444, 444, 444, 444, 444},  -- (27, 25)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (27, 26)
+		{459, 459, 475, 475, 491, 491, 507, 507, 460, 460, 476, 476, 492, 492, 508, 508, 508, 508, 508, 508, 508, 508, 508, 508},  -- (27, 27)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (27, 28)
+		{523, 523, 539, 539, 555, 555, 571, 571, 524, 524, 540, 540, 556, 556, 572, 572, 572, 572, 572, 572, 572, 572, 572, 572},  -- (27, 29)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (27, 30)
+		{587, 587, 603, 603, 619, 619, 635, 635, 588, 588, 604, 604, 620, 620, 636, 636, 636, 636, 636, 636, 636, 636, 636, 636},  -- (27, 31)
+	},
+	{
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (28, 0)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (28, 1)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (28, 2)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (28, 3)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (28, 4)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (28, 5)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (28, 6)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (28, 7)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (28, 8)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (28, 9)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (28, 10)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (28, 11)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (28, 12)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (28, 13)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (28, 14)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (28, 15)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (28, 16)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (28, 17)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (28, 18)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (28, 19)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (28, 20)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (28, 21)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (28, 22)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (28, 23)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (28, 24)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (28, 25)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (28, 26)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (28, 27)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (28, 28)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (28, 29)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (28, 30)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (28, 31)
+	},
+	{
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (29, 0)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (29, 1)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (29, 2)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (29, 3)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (29, 4)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (29, 5)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (29, 6)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (29, 7)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (29, 8)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (29, 9)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (29, 10)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (29, 11)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (29, 12)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (29, 13)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (29, 14)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (29, 15)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (29, 16)
+		{141, 141, 157, 157, 173, 173, 189, 189, 142, 142, 158, 158, 174, 174, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190},  -- (29, 17)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (29, 18)
+		{205, 205, 221, 221, 237, 237, 253, 253, 206, 206, 222, 222, 238, 238, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254},  -- (29, 19)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (29, 20)
+		{269, 269, 285, 285, 301, 301, 317, 317, 270, 270, 286, 286, 302, 302, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318},  -- (29, 21)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (29, 22)
+		{333, 333, 349, 349, 365, 365, 381, 381, 334, 334, 350, 350, 366, 366, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382},  -- (29, 23)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (29, 24)
+		{397, 397, 413, 413, 429, 429, 445, 445, 398, 398, 414, 414, 430, 430, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446},  -- (29, 25)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (29, 26)
+		{461, 461, 477, 477, 493, 493, 509, 509, 462, 462, 478, 478, 494, 494, 510, 510, 510, 510, 510, 510, 510, 510, 510, 510},  -- (29, 27)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (29, 28)
+		{525, 525, 541, 541, 557, 557, 573, 573, 526, 526, 542, 542, 558, 558, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574},  -- (29, 29)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (29, 30)
+		{589, 589, 605, 605, 621, 621, 637, 637, 590, 590, 606, 606, 622, 622, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638},  -- (29, 31)
+	},
+	{
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (30, 0)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (30, 1)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (30, 2)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (30, 3)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (30, 4)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (30, 5)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (30, 6)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (30, 7)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (30, 8)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (30, 9)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (30, 10)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (30, 11)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (30, 12)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (30, 13)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (30, 14)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (30, 15)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (30, 16)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (30, 17)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (30, 18)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (30, 19)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (30, 20)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (30, 21)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (30, 22)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (30, 23)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (30, 24)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (30, 25)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (30, 26)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (30, 27)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (30, 28)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (30, 29)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (30, 30)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (30, 31)
+	},
+	{
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (31, 0)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (31, 1)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (31, 2)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (31, 3)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (31, 4)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (31, 5)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (31, 6)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (31, 7)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (31, 8)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (31, 9)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (31, 10)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (31, 11)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (31, 12)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (31, 13)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (31, 14)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (31, 15)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (31, 16)
+		{143, 143, 159, 159, 175, 175, 191, 191, 144, 144, 160, 160, 176, 176, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192},  -- (31, 17)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (31, 18)
+		{207, 207, 223, 223, 239, 239, 255, 255, 208, 208, 224, 224, 240, 240, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256},  -- (31, 19)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (31, 20)
+		{271, 271, 287, 287, 303, 303, 319, 319, 272, 272, 288, 288, 304, 304, 320, 320, 320, 320, 320, 320, 320, 320, 320, 320},  -- (31, 21)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (31, 22)
+		{335, 335, 351, 351, 367, 367, 383, 383, 336, 336, 352, 352, 368, 368, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384},  -- (31, 23)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (31, 24)
+		{399, 399, 415, 415, 431, 431, 447, 447, 400, 400, 416, 416, 432, 432, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448},  -- (31, 25)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (31, 26)
+		{463, 463, 479, 479, 495, 495, 511, 511, 464, 464, 480, 480, 496, 496, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512},  -- (31, 27)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (31, 28)
+		{527, 527, 543, 543, 559, 559, 575, 575, 528, 528, 544, 544, 560, 560, 576, 576, 576, 576, 576, 576, 576, 576, 576, 576},  -- (31, 29)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (31, 30)
+		{591, 591, 607, 607, 623, 623, 639, 639, 592, 592, 608, 608, 624, 624, 640, 640, 640, 640, 640, 640, 640, 640, 640, 640},  -- (31, 31)
+	},
+}
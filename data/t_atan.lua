@@ -0,0 +1,917 @@
+coarse_atan_steps = 64
+coarse_atan =  -- Indexed by [dx][dy]
+{
+	[-65] =
+	{
+		[-64] = 20,
+		[64] = 13,
+	},
+	[-64] =
+	{
+		[-65] = 21,
+		[-64] = 21,
+		[-63] = 20,
+		[-62] = 20,
+		[-61] = 20,
+		[-60] = 20,
+		[-59] = 20,
+		[-58] = 20,
+		[-57] = 20,
+		[-56] = 20,
+		[-55] = 20,
+		[-54] = 20,
+		[-53] = 20,
+		[-52] = 20,
+		[-51] = 20,
+		[-50] = 20,
+		[-49] = 20,
+		[-48] = 20,
+		[-47] = 20,
+		[-46] = 20,
+		[-45] = 20,
+		[-44] = 20,
+		[-43] = 20,
+		[-42] = 19,
+		[-41] = 19,
+		[-40] = 19,
+		[-39] = 19,
+		[-38] = 19,
+		[-37] = 19,
+		[-36] = 19,
+		[-35] = 19,
+		[-34] = 19,
+		[-33] = 19,
+		[-32] = 19,
+		[-31] = 19,
+		[-30] = 19,
+		[-29] = 19,
+		[-28] = 19,
+		[-27] = 19,
+		[-26] = 18,
+		[-25] = 18,
+		[-24] = 18,
+		[-23] = 18,
+		[-22] = 18,
+		[-21] = 18,
+		[-20] = 18,
+		[-19] = 18,
+		[-18] = 18,
+		[-17] = 18,
+		[-16] = 18,
+		[-15] = 18,
+		[-14] = 18,
+		[-13] = 18,
+		[-12] = 17,
+		[-11] = 17,
+		[-10] = 17,
+		[-9] = 17,
+		[-8] = 17,
+		[-7] = 17,
+		[-6] = 17,
+		[-5] = 17,
+		[-4] = 17,
+		[-3] = 17,
+		[-2] = 17,
+		[-1] = 17,
+		[0] = 17,
+		[1] = 16,
+		[2] = 16,
+		[3] = 16,
+		[4] = 16,
+		[5] = 16,
+		[6] = 16,
+		[7] = 16,
+		[8] = 16,
+		[9] = 16,
+		[10] = 16,
+		[11] = 16,
+		[12] = 16,
+		[13] = 15,
+		[14] = 15,
+		[15] = 15,
+		[16] = 15,
+		[17] = 15,
+		[18] = 15,
+		[19] = 15,
+		[20] = 15,
+		[21] = 15,
+		[22] = 15,
+		[23] = 15,
+		[24] = 15,
+		[25] = 15,
+		[26] = 15,
+		[27] = 14,
+		[28] = 14,
+		[29] = 14,
+		[30] = 14,
+		[31] = 14,
+		[32] = 14,
+		[33] = 14,
+		[34] = 14,
+		[35] = 14,
+		[36] = 14,
+		[37] = 14,
+		[38] = 14,
+		[39] = 14,
+		[40] = 14,
+		[41] = 14,
+		[42] = 14,
+		[43] = 13,
+		[44] = 13,
+		[45] = 13,
+		[46] = 13,
+		[47] = 13,
+		[48] = 13,
+		[49] = 13,
+		[50] = 13,
+		[51] = 13,
+		[52] = 13,
+		[53] = 13,
+		[54] = 13,
+		[55] = 13,
+		[56] = 13,
+		[57] = 13,
+		[58] = 13,
+		[59] = 13,
+		[60] = 13,
+		[61] = 13,
+		[62] = 13,
+		[63] = 13,
+		[64] = 13,
+		[65] = 12,
+	},
+	[-63] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-62] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-61] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-60] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-59] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-58] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-57] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-56] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-55] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-54] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-53] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-52] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-51] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-50] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-49] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-48] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-47] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-46] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-45] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-44] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-43] =
+	{
+		[-64] = 21,
+		[64] = 12,
+	},
+	[-42] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-41] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-40] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-39] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-38] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-37] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-36] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-35] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-34] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-33] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-32] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-31] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-30] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-29] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-28] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-27] =
+	{
+		[-64] = 22,
+		[64] = 11,
+	},
+	[-26] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-25] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-24] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-23] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-22] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-21] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-20] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-19] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-18] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-17] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-16] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-15] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-14] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-13] =
+	{
+		[-64] = 23,
+		[64] = 10,
+	},
+	[-12] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-11] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-10] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-9] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-8] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-7] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-6] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-5] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-4] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-3] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-2] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[-1] =
+	{
+		[-64] = 24,
+		[64] = 9,
+	},
+	[0] =
+	{
+		[-64] = 25,
+		[64] = 9,
+	},
+	[1] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[2] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[3] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[4] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[5] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[6] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[7] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[8] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[9] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[10] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[11] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[12] =
+	{
+		[-64] = 25,
+		[64] = 8,
+	},
+	[13] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[14] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[15] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[16] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[17] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[18] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[19] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[20] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[21] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[22] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[23] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[24] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[25] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[26] =
+	{
+		[-64] = 26,
+		[64] = 7,
+	},
+	[27] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[28] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[29] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[30] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[31] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[32] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[33] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[34] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[35] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[36] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[37] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[38] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[39] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[40] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[41] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[42] =
+	{
+		[-64] = 27,
+		[64] = 6,
+	},
+	[43] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[44] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[45] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[46] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[47] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[48] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[49] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[50] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[51] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[52] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[53] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[54] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[55] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[56] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[57] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[58] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[59] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[60] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[61] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[62] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[63] =
+	{
+		[-64] = 28,
+		[64] = 5,
+	},
+	[64] =
+	{
+		[-65] = 28,
+		[-64] = 29,
+		[-63] = 29,
+		[-62] = 29,
+		[-61] = 29,
+		[-60] = 29,
+		[-59] = 29,
+		[-58] = 29,
+		[-57] = 29,
+		[-56] = 29,
+		[-55] = 29,
+		[-54] = 29,
+		[-53] = 29,
+		[-52] = 29,
+		[-51] = 29,
+		[-50] = 29,
+		[-49] = 29,
+		[-48] = 29,
+		[-47] = 29,
+		[-46] = 29,
+		[-45] = 29,
+		[-44] = 29,
+		[-43] = 29,
+		[-42] = 30,
+		[-41] = 30,
+		[-40] = 30,
+		[-39] = 30,
+		[-38] = 30,
+		[-37] = 30,
+		[-36] = 30,
+		[-35] = 30,
+		[-34] = 30,
+		[-33] = 30,
+		[-32] = 30,
+		[-31] = 30,
+		[-30] = 30,
+		[-29] = 30,
+		[-28] = 30,
+		[-27] = 30,
+		[-26] = 31,
+		[-25] = 31,
+		[-24] = 31,
+		[-23] = 31,
+		[-22] = 31,
+		[-21] = 31,
+		[-20] = 31,
+		[-19] = 31,
+		[-18] = 31,
+		[-17] = 31,
+		[-16] = 31,
+		[-15] = 31,
+		[-14] = 31,
+		[-13] = 31,
+		[-12] = 32,
+		[-11] = 32,
+		[-10] = 32,
+		[-9] = 32,
+		[-8] = 32,
+		[-7] = 32,
+		[-6] = 32,
+		[-5] = 32,
+		[-4] = 32,
+		[-3] = 32,
+		[-2] = 32,
+		[-1] = 32,
+		[0] = 1,
+		[1] = 1,
+		[2] = 1,
+		[3] = 1,
+		[4] = 1,
+		[5] = 1,
+		[6] = 1,
+		[7] = 1,
+		[8] = 1,
+		[9] = 1,
+		[10] = 1,
+		[11] = 1,
+		[12] = 1,
+		[13] = 2,
+		[14] = 2,
+		[15] = 2,
+		[16] = 2,
+		[17] = 2,
+		[18] = 2,
+		[19] = 2,
+		[20] = 2,
+		[21] = 2,
+		[22] = 2,
+		[23] = 2,
+		[24] = 2,
+		[25] = 2,
+		[26] = 2,
+		[27] = 3,
+		[28] = 3,
+		[29] = 3,
+		[30] = 3,
+		[31] = 3,
+		[32] = 3,
+		[33] = 3,
+		[34] = 3,
+		[35] = 3,
+		[36] = 3,
+		[37] = 3,
+		[38] = 3,
+		[39] = 3,
+		[40] = 3,
+		[41] = 3,
+		[42] = 3,
+		[43] = 4,
+		[44] = 4,
+		[45] = 4,
+		[46] = 4,
+		[47] = 4,
+		[48] = 4,
+		[49] = 4,
+		[50] = 4,
+		[51] = 4,
+		[52] = 4,
+		[53] = 4,
+		[54] = 4,
+		[55] = 4,
+		[56] = 4,
+		[57] = 4,
+		[58] = 4,
+		[59] = 4,
+		[60] = 4,
+		[61] = 4,
+		[62] = 4,
+		[63] = 4,
+		[64] = 5,
+		[65] = 5,
+	},
+	[65] =
+	{
+		[-64] = 29,
+		[64] = 4,
+	},
+}
@@ -0,0 +1,36 @@
+converge_angle =
+{
+	-- 1   2   3   4   5   6   7   8   9  10  11  12  13  14  15  16  17  18  19  20  21  22  23  24  25  26  27  28  29  30  31  32
+	{  1,  2,  2,  2,  2,  2,  2,  2,  3,  3,  3,  3,  4,  4,  4,  4, 29, 30, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32},  -- 1
+	{  1,  2,  3,  3,  3,  3,  3,  3,  3,  4,  4,  4,  4,  5,  5,  5,  5, 30, 31, 31, 31, 31, 32, 32, 32, 32,  1,  1,  1,  1,  1,  1},  -- 2
+	{  2,  2,  3,  4,  4,  4,  4,  4,  4,  4,  5,  5,  5,  5,  6,  6,  6,  6, 31, 32, 32, 32, 32,  1,  1,  1,  1,  2,  2,  2,  2,  2},  -- 3
+	{  3,  3,  3,  4,  5,  5,  5,  5,  5,  5,  5,  6,  6,  6,  6,  7,  7,  7,  7, 32,  1,  1,  1,  1,  2,  2,  2,  2,  3,  3,  3,  3},  -- 4
+	{  4,  4,  4,  4,  5,  6,  6,  6,  6,  6,  6,  6,  7,  7,  7,  7,  8,  8,  8,  8,  1,  2,  2,  2,  2,  3,  3,  3,  3,  4,  4,  4},  -- 5
+	{  5,  5,  5,  5,  5,  6,  7,  7,  7,  7,  7,  7,  7,  8,  8,  8,  8,  9,  9,  9,  9,  2,  3,  3,  3,  3,  4,  4,  4,  4,  5,  5},  -- 6
+	{  6,  6,  6,  6,  6,  6,  7,  8,  8,  8,  8,  8,  8,  8,  9,  9,  9,  9, 10, 10, 10, 10,  3,  4,  4,  4,  4,  5,  5,  5,  5,  6},  -- 7
+	{  7,  7,  7,  7,  7,  7,  7,  8,  9,  9,  9,  9,  9,  9,  9, 10, 10, 10, 10, 11, 11, 11, 11,  4,  5,  5,  5,  5,  6,  6,  6,  6},  -- 8
+	{  7,  8,  8,  8,  8,  8,  8,  8,  9, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 12, 12, 12, 12,  5,  6,  6,  6,  6,  7,  7,  7},  -- 9
+	{  8,  8,  9,  9,  9,  9,  9,  9,  9, 10, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 13, 13, 13, 13,  6,  7,  7,  7,  7,  8,  8},  -- 10
+	{  9,  9,  9, 10, 10, 10, 10, 10, 10, 10, 11, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14,  7,  8,  8,  8,  8,  9},  -- 11
+	{ 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 12, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15,  8,  9,  9,  9,  9},  -- 12
+	{ 10, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 13, 14, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 16,  9, 10, 10, 10},  -- 13
+	{ 11, 11, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 14, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 17, 10, 11, 11},  -- 14
+	{ 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 15, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 18, 11, 12},  -- 15
+	{ 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 16, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 19, 12},  -- 16
+	{ 13, 14, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 17, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 20, 20, 20, 20},  -- 17
+	{ 21, 14, 15, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 18, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 21, 21, 21},  -- 18
+	{ 22, 22, 15, 16, 16, 16, 16, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 19, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22},  -- 19
+	{ 23, 23, 23, 16, 17, 17, 17, 17, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 20, 21, 21, 21, 21, 21, 21, 21, 22, 22, 22, 22, 23},  -- 20
+	{ 24, 24, 24, 24, 17, 18, 18, 18, 18, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 21, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23},  -- 21
+	{ 24, 25, 25, 25, 25, 18, 19, 19, 19, 19, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 22, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24},  -- 22
+	{ 25, 25, 26, 26, 26, 26, 19, 20, 20, 20, 20, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 23, 24, 24, 24, 24, 24, 24, 24, 25, 25},  -- 23
+	{ 26, 26, 26, 27, 27, 27, 27, 20, 21, 21, 21, 21, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 24, 25, 25, 25, 25, 25, 25, 25, 26},  -- 24
+	{ 27, 27, 27, 27, 28, 28, 28, 28, 21, 22, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 25, 26, 26, 26, 26, 26, 26, 26},  -- 25
+	{ 27, 28, 28, 28, 28, 29, 29, 29, 29, 22, 23, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 26, 27, 27, 27, 27, 27, 27},  -- 26
+	{ 28, 28, 29, 29, 29, 29, 30, 30, 30, 30, 23, 24, 24, 24, 24, 25, 25, 25, 25, 26, 26, 26, 26, 26, 26, 26, 27, 28, 28, 28, 28, 28},  -- 27
+	{ 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 24, 25, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 27, 28, 29, 29, 29, 29},  -- 28
+	{ 30, 30, 30, 30, 31, 31, 31, 31, 32, 32, 32, 32, 25, 26, 26, 26, 26, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 29, 30, 30, 30},  -- 29
+	{ 31, 31, 31, 31, 31, 32, 32, 32, 32,  1,  1,  1,  1, 26, 27, 27, 27, 27, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29, 29, 30, 31, 31},  -- 30
+	{ 32, 32, 32, 32, 32, 32,  1,  1,  1,  1,  2,  2,  2,  2, 27, 28, 28, 28, 28, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 31, 32},  -- 31
+	{  1,  1,  1,  1,  1,  1,  1,  2,  2,  2,  2,  3,  3,  3,  3, 28, 29, 29, 29, 29, 30, 30, 30, 30, 31, 31, 31, 31, 31, 31, 31, 32},  -- 32
+}
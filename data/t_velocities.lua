@@ -0,0 +1,1810 @@
+velocity =
+{
+	-- Rock.
+	{
+		{
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+			{768, 0},
+		},
+		{
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+			{753, 150},
+		},
+		{
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+			{710, 294},
+		},
+		{
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+			{639, 427},
+		},
+		{
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+			{543, 543},
+		},
+		{
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+			{427, 639},
+		},
+		{
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+			{294, 710},
+		},
+		{
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+			{150, 753},
+		},
+		{
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+			{0, 768},
+		},
+		{
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+			{-150, 753},
+		},
+		{
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+			{-294, 710},
+		},
+		{
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+			{-427, 639},
+		},
+		{
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+			{-543, 543},
+		},
+		{
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+			{-639, 427},
+		},
+		{
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+			{-710, 294},
+		},
+		{
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+			{-753, 150},
+		},
+		{
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+			{-768, 0},
+		},
+		{
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+			{-753, -150},
+		},
+		{
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+			{-710, -294},
+		},
+		{
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+			{-639, -427},
+		},
+		{
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+			{-543, -543},
+		},
+		{
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+			{-427, -639},
+		},
+		{
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+			{-294, -710},
+		},
+		{
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+			{-150, -753},
+		},
+		{
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+			{0, -768},
+		},
+		{
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+			{150, -753},
+		},
+		{
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+			{294, -710},
+		},
+		{
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+			{427, -639},
+		},
+		{
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+			{543, -543},
+		},
+		{
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+			{639, -427},
+		},
+		{
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+			{710, -294},
+		},
+		{
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+			{753, -150},
+		},
+	},
+	-- Paper.
+	{
+		{
+			{745, 0},
+			{1489, 0},
+			{2234, 0},
+			{2979, 0},
+			{745, 0},
+			{683, 0},
+			{621, 0},
+			{559, 0},
+			{496, 0},
+			{434, 0},
+			{372, 0},
+			{310, 0},
+			{248, 0},
+			{186, 0},
+			{124, 0},
+			{62, 0},
+		},
+		{
+			{730, 145},
+			{1461, 291},
+			{2191, 436},
+			{2922, 581},
+			{730, 145},
+			{670, 133},
+			{609, 121},
+			{548, 109},
+			{487, 97},
+			{426, 85},
+			{365, 73},
+			{304, 61},
+			{243, 48},
+			{183, 36},
+			{122, 24},
+			{61, 12},
+		},
+		{
+			{688, 285},
+			{1376, 570},
+			{2064, 855},
+			{2752, 1140},
+			{688, 285},
+			{631, 261},
+			{573, 237},
+			{516, 214},
+			{459, 190},
+			{401, 166},
+			{344, 142},
+			{287, 119},
+			{229, 95},
+			{172, 71},
+			{115, 47},
+			{57, 24},
+		},
+		{
+			{619, 414},
+			{1238, 827},
+			{1858, 1241},
+			{2477, 1655},
+			{619, 414},
+			{568, 379},
+			{516, 345},
+			{464, 310},
+			{413, 276},
+			{361, 241},
+			{310, 207},
+			{258, 172},
+			{206, 138},
+			{155, 103},
+			{103, 69},
+			{52, 34},
+		},
+		{
+			{527, 527},
+			{1053, 1053},
+			{1580, 1580},
+			{2106, 2106},
+			{527, 527},
+			{483, 483},
+			{439, 439},
+			{395, 395},
+			{351, 351},
+			{307, 307},
+			{263, 263},
+			{219, 219},
+			{176, 176},
+			{132, 132},
+			{88, 88},
+			{44, 44},
+		},
+		{
+			{414, 619},
+			{827, 1238},
+			{1241, 1858},
+			{1655, 2477},
+			{414, 619},
+			{379, 568},
+			{345, 516},
+			{310, 464},
+			{276, 413},
+			{241, 361},
+			{207, 310},
+			{172, 258},
+			{138, 206},
+			{103, 155},
+			{69, 103},
+			{34, 52},
+		},
+		{
+			{285, 688},
+			{570, 1376},
+			{855, 2064},
+			{1140, 2752},
+			{285, 688},
+			{261, 631},
+			{237, 573},
+			{214, 516},
+			{190, 459},
+			{166, 401},
+			{142, 344},
+			{119, 287},
+			{95, 229},
+			{71, 172},
+			{47, 115},
+			{24, 57},
+		},
+		{
+			{145, 730},
+			{291, 1461},
+			{436, 2191},
+			{581, 2922},
+			{145, 730},
+			{133, 670},
+			{121, 609},
+			{109, 548},
+			{97, 487},
+			{85, 426},
+			{73, 365},
+			{61, 304},
+			{48, 243},
+			{36, 183},
+			{24, 122},
+			{12, 61},
+		},
+		{
+			{0, 745},
+			{0, 1489},
+			{0, 2234},
+			{0, 2979},
+			{0, 745},
+			{0, 683},
+			{0, 621},
+			{0, 559},
+			{0, 496},
+			{0, 434},
+			{0, 372},
+			{0, 310},
+			{0, 248},
+			{0, 186},
+			{0, 124},
+			{0, 62},
+		},
+		{
+			{-145, 730},
+			{-291, 1461},
+			{-436, 2191},
+			{-581, 2922},
+			{-145, 730},
+			{-133, 670},
+			{-121, 609},
+			{-109, 548},
+			{-97, 487},
+			{-85, 426},
+			{-73, 365},
+			{-61, 304},
+			{-48, 243},
+			{-36, 183},
+			{-24, 122},
+			{-12, 61},
+		},
+		{
+			{-285, 688},
+			{-570, 1376},
+			{-855, 2064},
+			{-1140, 2752},
+			{-285, 688},
+			{-261, 631},
+			{-237, 573},
+			{-214, 516},
+			{-190, 459},
+			{-166, 401},
+			{-142, 344},
+			{-119, 287},
+			{-95, 229},
+			{-71, 172},
+			{-47, 115},
+			{-24, 57},
+		},
+		{
+			{-414, 619},
+			{-827, 1238},
+			{-1241, 1858},
+			{-1655, 2477},
+			{-414, 619},
+			{-379, 568},
+			{-345, 516},
+			{-310, 464},
+			{-276, 413},
+			{-241, 361},
+			{-207, 310},
+			{-172, 258},
+			{-138, 206},
+			{-103, 155},
+			{-69, 103},
+			{-34, 52},
+		},
+		{
+			{-527, 527},
+			{-1053, 1053},
+			{-1580, 1580},
+			{-2106, 2106},
+			{-527, 527},
+			{-483, 483},
+			{-439, 439},
+			{-395, 395},
+			{-351, 351},
+			{-307, 307},
+			{-263, 263},
+			{-219, 219},
+			{-176, 176},
+			{-132, 132},
+			{-88, 88},
+			{-44, 44},
+		},
+		{
+			{-619, 414},
+			{-1238, 827},
+			{-1858, 1241},
+			{-2477, 1655},
+			{-619, 414},
+			{-568, 379},
+			{-516, 345},
+			{-464, 310},
+			{-413, 276},
+			{-361, 241},
+			{-310, 207},
+			{-258, 172},
+			{-206, 138},
+			{-155, 103},
+			{-103, 69},
+			{-52, 34},
+		},
+		{
+			{-688, 285},
+			{-1376, 570},
+			{-2064, 855},
+			{-2752, 1140},
+			{-688, 285},
+			{-631, 261},
+			{-573, 237},
+			{-516, 214},
+			{-459, 190},
+			{-401, 166},
+			{-344, 142},
+			{-287, 119},
+			{-229, 95},
+			{-172, 71},
+			{-115, 47},
+			{-57, 24},
+		},
+		{
+			{-730, 145},
+			{-1461, 291},
+			{-2191, 436},
+			{-2922, 581},
+			{-730, 145},
+			{-670, 133},
+			{-609, 121},
+			{-548, 109},
+			{-487, 97},
+			{-426, 85},
+			{-365, 73},
+			{-304, 61},
+			{-243, 48},
+			{-183, 36},
+			{-122, 24},
+			{-61, 12},
+		},
+		{
+			{-745, 0},
+			{-1489, 0},
+			{-2234, 0},
+			{-2979, 0},
+			{-745, 0},
+			{-683, 0},
+			{-621, 0},
+			{-559, 0},
+			{-496, 0},
+			{-434, 0},
+			{-372, 0},
+			{-310, 0},
+			{-248, 0},
+			{-186, 0},
+			{-124, 0},
+			{-62, 0},
+		},
+		{
+			{-730, -145},
+			{-1461, -291},
+			{-2191, -436},
+			{-2922, -581},
+			{-730, -145},
+			{-670, -133},
+			{-609, -121},
+			{-548, -109},
+			{-487, -97},
+			{-426, -85},
+			{-365, -73},
+			{-304, -61},
+			{-243, -48},
+			{-183, -36},
+			{-122, -24},
+			{-61, -12},
+		},
+		{
+			{-688, -285},
+			{-1376, -570},
+			{-2064, -855},
+			{-2752, -1140},
+			{-688, -285},
+			{-631, -261},
+			{-573, -237},
+			{-516, -214},
+			{-459, -190},
+			{-401, -166},
+			{-344, -142},
+			{-287, -119},
+			{-229, -95},
+			{-172, -71},
+			{-115, -47},
+			{-57, -24},
+		},
+		{
+			{-619, -414},
+			{-1238, -827},
+			{-1858, -1241},
+			{-2477, -1655},
+			{-619, -414},
+			{-568, -379},
+			{-516, -345},
+			{-464, -310},
+			{-413, -276},
+			{-361, -241},
+			{-310, -207},
+			{-258, -172},
+			{-206, -138},
+			{-155, -103},
+			{-103, -69},
+			{-52, -34},
+		},
+		{
+			{-527, -527},
+			{-1053, -1053},
+			{-1580, -1580},
+			{-2106, -2106},
+			{-527, -527},
+			{-483, -483},
+			{-439, -439},
+			{-395, -395},
+			{-351, -351},
+			{-307, -307},
+			{-263, -263},
+			{-219, -219},
+			{-176, -176},
+			{-132, -132},
+			{-88, -88},
+			{-44, -44},
+		},
+		{
+			{-414, -619},
+			{-827, -1238},
+			{-1241, -1858},
+			{-1655, -2477},
+			{-414, -619},
+			{-379, -568},
+			{-345, -516},
+			{-310, -464},
+			{-276, -413},
+			{-241, -361},
+			{-207, -310},
+			{-172, -258},
+			{-138, -206},
+			{-103, -155},
+			{-69, -103},
+			{-34, -52},
+		},
+		{
+			{-285, -688},
+			{-570, -1376},
+			{-855, -2064},
+			{-1140, -2752},
+			{-285, -688},
+			{-261, -631},
+			{-237, -573},
+			{-214, -516},
+			{-190, -459},
+			{-166, -401},
+			{-142, -344},
+			{-119, -287},
+			{-95, -229},
+			{-71, -172},
+			{-47, -115},
+			{-24, -57},
+		},
+		{
+			{-145, -730},
+			{-291, -1461},
+			{-436, -2191},
+			{-581, -2922},
+			{-145, -730},
+			{-133, -670},
+			{-121, -609},
+			{-109, -548},
+			{-97, -487},
+			{-85, -426},
+			{-73, -365},
+			{-61, -304},
+			{-48, -243},
+			{-36, -183},
+			{-24, -122},
+			{-12, -61},
+		},
+		{
+			{0, -745},
+			{0, -1489},
+			{0, -2234},
+			{0, -2979},
+			{0, -745},
+			{0, -683},
+			{0, -621},
+			{0, -559},
+			{0, -496},
+			{0, -434},
+			{0, -372},
+			{0, -310},
+			{0, -248},
+			{0, -186},
+			{0, -124},
+			{0, -62},
+		},
+		{
+			{145, -730},
+			{291, -1461},
+			{436, -2191},
+			{581, -2922},
+			{145, -730},
+			{133, -670},
+			{121, -609},
+			{109, -548},
+			{97, -487},
+			{85, -426},
+			{73, -365},
+			{61, -304},
+			{48, -243},
+			{36, -183},
+			{24, -122},
+			{12, -61},
+		},
+		{
+			{285, -688},
+			{570, -1376},
+			{855, -2064},
+			{1140, -2752},
+			{285, -688},
+			{261, -631},
+			{237, -573},
+			{214, -516},
+			{190, -459},
+			{166, -401},
+			{142, -344},
+			{119, -287},
+			{95, -229},
+			{71, -172},
+			{47, -115},
+			{24, -57},
+		},
+		{
+			{414, -619},
+			{827, -1238},
+			{1241, -1858},
+			{1655, -2477},
+			{414, -619},
+			{379, -568},
+			{345, -516},
+			{310, -464},
+			{276, -413},
+			{241, -361},
+			{207, -310},
+			{172, -258},
+			{138, -206},
+			{103, -155},
+			{69, -103},
+			{34, -52},
+		},
+		{
+			{527, -527},
+			{1053, -1053},
+			{1580, -1580},
+			{2106, -2106},
+			{527, -527},
+			{483, -483},
+			{439, -439},
+			{395, -395},
+			{351, -351},
+			{307, -307},
+			{263, -263},
+			{219, -219},
+			{176, -176},
+			{132, -132},
+			{88, -88},
+			{44, -44},
+		},
+		{
+			{619, -414},
+			{1238, -827},
+			{1858, -1241},
+			{2477, -1655},
+			{619, -414},
+			{568, -379},
+			{516, -345},
+			{464, -310},
+			{413, -276},
+			{361, -241},
+			{310, -207},
+			{258, -172},
+			{206, -138},
+			{155, -103},
+			{103, -69},
+			{52, -34},
+		},
+		{
+			{688, -285},
+			{1376, -570},
+			{2064, -855},
+			{2752, -1140},
+			{688, -285},
+			{631, -261},
+			{573, -237},
+			{516, -214},
+			{459, -190},
+			{401, -166},
+			{344, -142},
+			{287, -119},
+			{229, -95},
+			{172, -71},
+			{115, -47},
+			{57, -24},
+		},
+		{
+			{730, -145},
+			{1461, -291},
+			{2191, -436},
+			{2922, -581},
+			{730, -145},
+			{670, -133},
+			{609, -121},
+			{548, -109},
+			{487, -97},
+			{426, -85},
+			{365, -73},
+			{304, -61},
+			{243, -48},
+			{183, -36},
+			{122, -24},
+			{61, -12},
+		},
+	},
+	-- Scissors.
+	{
+		{
+			{0, 0},
+			{1024, 0},
+			{1755, 0},
+			{2194, 0},
+			{2341, 0},
+			{2194, 0},
+			{1755, 0},
+			{1024, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{1004, 200},
+			{1722, 342},
+			{2152, 428},
+			{2296, 457},
+			{2152, 428},
+			{1722, 342},
+			{1004, 200},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{946, 392},
+			{1622, 672},
+			{2027, 840},
+			{2162, 896},
+			{2027, 840},
+			{1622, 672},
+			{946, 392},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{851, 569},
+			{1460, 975},
+			{1824, 1219},
+			{1946, 1300},
+			{1824, 1219},
+			{1460, 975},
+			{851, 569},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{724, 724},
+			{1241, 1241},
+			{1552, 1552},
+			{1655, 1655},
+			{1552, 1552},
+			{1241, 1241},
+			{724, 724},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{569, 851},
+			{975, 1460},
+			{1219, 1824},
+			{1300, 1946},
+			{1219, 1824},
+			{975, 1460},
+			{569, 851},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{392, 946},
+			{672, 1622},
+			{840, 2027},
+			{896, 2162},
+			{840, 2027},
+			{672, 1622},
+			{392, 946},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{200, 1004},
+			{342, 1722},
+			{428, 2152},
+			{457, 2296},
+			{428, 2152},
+			{342, 1722},
+			{200, 1004},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{0, 1024},
+			{0, 1755},
+			{0, 2194},
+			{0, 2341},
+			{0, 2194},
+			{0, 1755},
+			{0, 1024},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-200, 1004},
+			{-342, 1722},
+			{-428, 2152},
+			{-457, 2296},
+			{-428, 2152},
+			{-342, 1722},
+			{-200, 1004},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-392, 946},
+			{-672, 1622},
+			{-840, 2027},
+			{-896, 2162},
+			{-840, 2027},
+			{-672, 1622},
+			{-392, 946},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-569, 851},
+			{-975, 1460},
+			{-1219, 1824},
+			{-1300, 1946},
+			{-1219, 1824},
+			{-975, 1460},
+			{-569, 851},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-724, 724},
+			{-1241, 1241},
+			{-1552, 1552},
+			{-1655, 1655},
+			{-1552, 1552},
+			{-1241, 1241},
+			{-724, 724},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-851, 569},
+			{-1460, 975},
+			{-1824, 1219},
+			{-1946, 1300},
+			{-1824, 1219},
+			{-1460, 975},
+			{-851, 569},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-946, 392},
+			{-1622, 672},
+			{-2027, 840},
+			{-2162, 896},
+			{-2027, 840},
+			{-1622, 672},
+			{-946, 392},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-1004, 200},
+			{-1722, 342},
+			{-2152, 428},
+			{-2296, 457},
+			{-2152, 428},
+			{-1722, 342},
+			{-1004, 200},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-1024, 0},
+			{-1755, 0},
+			{-2194, 0},
+			{-2341, 0},
+			{-2194, 0},
+			{-1755, 0},
+			{-1024, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-1004, -200},
+			{-1722, -342},
+			{-2152, -428},
+			{-2296, -457},
+			{-2152, -428},
+			{-1722, -342},
+			{-1004, -200},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-946, -392},
+			{-1622, -672},
+			{-2027, -840},
+			{-2162, -896},
+			{-2027, -840},
+			{-1622, -672},
+			{-946, -392},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-851, -569},
+			{-1460, -975},
+			{-1824, -1219},
+			{-1946, -1300},
+			{-1824, -1219},
+			{-1460, -975},
+			{-851, -569},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-724, -724},
+			{-1241, -1241},
+			{-1552, -1552},
+			{-1655, -1655},
+			{-1552, -1552},
+			{-1241, -1241},
+			{-724, -724},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-569, -851},
+			{-975, -1460},
+			{-1219, -1824},
+			{-1300, -1946},
+			{-1219, -1824},
+			{-975, -1460},
+			{-569, -851},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-392, -946},
+			{-672, -1622},
+			{-840, -2027},
+			{-896, -2162},
+			{-840, -2027},
+			{-672, -1622},
+			{-392, -946},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{-200, -1004},
+			{-342, -1722},
+			{-428, -2152},
+			{-457, -2296},
+			{-428, -2152},
+			{-342, -1722},
+			{-200, -1004},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{0, -1024},
+			{0, -1755},
+			{0, -2194},
+			{0, -2341},
+			{0, -2194},
+			{0, -1755},
+			{0, -1024},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{200, -1004},
+			{342, -1722},
+			{428, -2152},
+			{457, -2296},
+			{428, -2152},
+			{342, -1722},
+			{200, -1004},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{392, -946},
+			{672, -1622},
+			{840, -2027},
+			{896, -2162},
+			{840, -2027},
+			{672, -1622},
+			{392, -946},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{569, -851},
+			{975, -1460},
+			{1219, -1824},
+			{1300, -1946},
+			{1219, -1824},
+			{975, -1460},
+			{569, -851},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{724, -724},
+			{1241, -1241},
+			{1552, -1552},
+			{1655, -1655},
+			{1552, -1552},
+			{1241, -1241},
+			{724, -724},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{851, -569},
+			{1460, -975},
+			{1824, -1219},
+			{1946, -1300},
+			{1824, -1219},
+			{1460, -975},
+			{851, -569},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{946, -392},
+			{1622, -672},
+			{2027, -840},
+			{2162, -896},
+			{2027, -840},
+			{1622, -672},
+			{946, -392},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+		{
+			{0, 0},
+			{1004, -200},
+			{1722, -342},
+			{2152, -428},
+			{2296, -457},
+			{2152, -428},
+			{1722, -342},
+			{1004, -200},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+			{0, 0},
+		},
+	},
+}
+average_velocity =
+{
+	{768, 0},
+	{753, 150},
+	{710, 294},
+	{639, 427},
+	{543, 543},
+	{427, 639},
+	{294, 710},
+	{150, 753},
+	{0, 768},
+	{-150, 753},
+	{-294, 710},
+	{-427, 639},
+	{-543, 543},
+	{-639, 427},
+	{-710, 294},
+	{-753, 150},
+	{-768, 0},
+	{-753, -150},
+	{-710, -294},
+	{-639, -427},
+	{-543, -543},
+	{-427, -639},
+	{-294, -710},
+	{-150, -753},
+	{0, -768},
+	{150, -753},
+	{294, -710},
+	{427, -639},
+	{543, -543},
+	{639, -427},
+	{710, -294},
+	{753, -150},
+}
+slime_velocity =
+{
+	{256, 0},
+	{251, 50},
+	{237, 98},
+	{213, 142},
+	{181, 181},
+	{142, 213},
+	{98, 237},
+	{50, 251},
+	{0, 256},
+	{-50, 251},
+	{-98, 237},
+	{-142, 213},
+	{-181, 181},
+	{-213, 142},
+	{-237, 98},
+	{-251, 50},
+	{-256, 0},
+	{-251, -50},
+	{-237, -98},
+	{-213, -142},
+	{-181, -181},
+	{-142, -213},
+	{-98, -237},
+	{-50, -251},
+	{0, -256},
+	{50, -251},
+	{98, -237},
+	{142, -213},
+	{181, -181},
+	{213, -142},
+	{237, -98},
+	{251, -50},
+}
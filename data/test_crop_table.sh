@@ -191,6 +191,53 @@ convert \
 "./$TOOL" 5 4 3 1 2 1 < "$TEST_DIR/input.png" > "$TEST_DIR/actual.png"
 check_output "$LINENO: offset"
 
+# Crop with ordered dithering.  Input is uniform 50% gray, which dithers
+# to a checkerboard where pixel (x,y) is black if x+y is even.  The crop
+# offsets and tile sizes are odd, so output pattern is only correct if
+# dithering is keyed on input coordinates.
+#
+# Input x = 2 3 7 8, input y = 1 2 5 6.
+ppmmake rgb:80/80/80 10 8 > "$TEST_DIR/gray.ppm"
+pgmmake 1 10 8 > "$TEST_DIR/gray_alpha.pgm"
+pnmtopng -alpha="$TEST_DIR/gray_alpha.pgm" "$TEST_DIR/gray.ppm" \
+   > "$TEST_DIR/gray.png"
+cat <<EOT > "$TEST_DIR/dither.pgm"
+P2
+4 4
+255
+255   0   0 255
+  0 255 255   0
+255   0   0 255
+  0 255 255   0
+EOT
+pgmmake 1 4 4 > "$TEST_DIR/dither_alpha.pgm"
+pnmtopng -alpha="$TEST_DIR/dither_alpha.pgm" "$TEST_DIR/dither.pgm" \
+   > "$TEST_DIR/expected.png"
+
+"./$TOOL" -d 5 4 2 2 2 1 < "$TEST_DIR/gray.png" > "$TEST_DIR/actual.png"
+check_output "$LINENO: dither"
+
+# Multiple crops in one run should produce the same output as running
+# each crop separately.
+"./$TOOL" -d 5 4 2 2 2 1 < "$TEST_DIR/gray.png" > "$TEST_DIR/expected.png"
+"./$TOOL" 5 4 3 2 1 1 < "$TEST_DIR/gray.png" > "$TEST_DIR/expected2.png"
+"./$TOOL" -i "$TEST_DIR/gray.png" \
+   -d 5 4 2 2 2 1 "$TEST_DIR/actual.png" \
+   5 4 3 2 1 1 "$TEST_DIR/actual2.png"
+check_output "$LINENO: multiple crops, first output"
+cp "$TEST_DIR/expected2.png" "$TEST_DIR/expected.png"
+cp "$TEST_DIR/actual2.png" "$TEST_DIR/actual.png"
+check_output "$LINENO: multiple crops, second output"
+
+cat "$TEST_DIR/input.png" | "./$TOOL" -i - \
+   5 4 5 2 0 1 "$TEST_DIR/actual2.png" \
+   5 4 3 2 1 1 - > "$TEST_DIR/actual.png"
+"./$TOOL" 5 4 3 2 1 1 < "$TEST_DIR/input.png" > "$TEST_DIR/expected.png"
+check_output "$LINENO: multiple crops from stdin"
+"./$TOOL" 5 4 5 2 0 1 < "$TEST_DIR/input.png" > "$TEST_DIR/expected.png"
+cp "$TEST_DIR/actual2.png" "$TEST_DIR/actual.png"
+check_output "$LINENO: multiple crops, contiguous output"
+
 # Check invalid arguments.
 "./$TOOL" 6 4 1 1 0 0 \
    < "$TEST_DIR/input.png" \
@@ -208,6 +255,18 @@ if ! ( grep -qF "Invalid crop parameters" "$TEST_DIR/error.txt" ); then
    die "$LINENO: missing error message"
 fi
 
+rm -f "$TEST_DIR/actual.png" "$TEST_DIR/actual2.png"
+"./$TOOL" -i "$TEST_DIR/input.png" \
+   5 4 3 2 1 1 "$TEST_DIR/actual.png" \
+   6 4 1 1 0 0 "$TEST_DIR/actual2.png" \
+   2> "$TEST_DIR/error.txt" && die "$LINENO: unexpected success"
+if ! ( grep -qF "Image dimension" "$TEST_DIR/error.txt" ); then
+   die "$LINENO: missing error message"
+fi
+if [[ -e "$TEST_DIR/actual.png" || -e "$TEST_DIR/actual2.png" ]]; then
+   die "$LINENO: incomplete output not removed"
+fi
+
 # Cleanup.
 rm -rf "$TEST_DIR"
 exit 0
@@ -0,0 +1,72 @@
+#!/bin/bash
+
+if [[ $# -ne 1 ]]; then
+   echo "$0 {dedup_tiles.exe}"
+   exit 1
+fi
+TOOL=$1
+TEST_DIR=$(mktemp -d)
+
+set -euo pipefail
+
+function die
+{
+   echo "$1"
+   rm -rf "$TEST_DIR"
+   exit 1
+}
+
+# Write raw GA8 image (see image_io.h) from a list of hex pixel bytes.
+function raw_image
+{
+   local width=$1
+   local height=$2
+   shift 2
+   perl -e 'print "\x89GA8", pack("V3", 1, $ARGV[0], $ARGV[1]);
+            print pack("C*", map {hex} @ARGV[2..$#ARGV])' \
+        "$width" "$height" "$@"
+}
+
+# Generate test input: 4x2 grid of 2x1 tiles, where tiles are
+#   A B A E
+#   E C B A
+# and E is fully transparent.
+INPUT="$TEST_DIR/input.ga8"
+raw_image 8 2 \
+   ff ff 00 ff   00 ff ff ff   ff ff 00 ff   00 00 00 00 \
+   00 00 00 00   80 ff 80 ff   00 ff ff ff   ff ff 00 ff \
+   > "$INPUT"
+
+# Report only.
+"./$TOOL" 2 1 "$INPUT" 2> "$TEST_DIR/report.txt" \
+   || die "$TOOL failed: $?"
+grep -qF "8 tiles, 4 unique (2 empty), ratio 0.500, atlas 8x1" \
+   "$TEST_DIR/report.txt" \
+   || die "Unexpected report: $(cat "$TEST_DIR/report.txt")"
+
+# Atlas and remap table.
+ATLAS="$TEST_DIR/atlas.ga8"
+REMAP="$TEST_DIR/remap.lua"
+"./$TOOL" 2 1 "$INPUT" "$ATLAS" "$REMAP" test_remap 2> /dev/null \
+   || die "$TOOL failed: $?"
+
+EXPECTED_ATLAS="$TEST_DIR/expected.ga8"
+raw_image 8 1 \
+   ff ff 00 ff   00 ff ff ff   00 00 00 00   80 ff 80 ff \
+   > "$EXPECTED_ATLAS"
+cmp -s "$EXPECTED_ATLAS" "$ATLAS" || die "Atlas mismatched"
+
+EXPECTED_REMAP="$TEST_DIR/expected.lua"
+printf 'test_remap =\n{\n\t1, 2, 1, 3, 3, 4, 2, 1\n}\n' > "$EXPECTED_REMAP"
+if ! ( diff "$EXPECTED_REMAP" "$REMAP" ); then
+   die "Remap mismatched"
+fi
+
+# Invalid tile size.
+if ( "./$TOOL" 3 1 "$INPUT" > /dev/null 2>&1 ); then
+   die "$TOOL should fail for mismatched tile size"
+fi
+
+# Cleanup.
+rm -rf "$TEST_DIR"
+exit 0
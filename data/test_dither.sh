@@ -13,12 +13,18 @@ INPUT_IMAGE=$(mktemp)
 EXPECTED_PIXELS=$(mktemp)
 EXPECTED_ALPHA=$(mktemp)
 ACTUAL_OUTPUT=$(mktemp)
+PACKED_OUTPUT=$(mktemp)
+RAW_OUTPUT=$(mktemp --suffix=.ga8)
+MANIFEST=$(mktemp)
+CACHE_DIR=$(mktemp -d)
 
 function die
 {
    echo "$1"
    rm -f "$INPUT_PIXELS" "$INPUT_ALPHA" "$INPUT_IMAGE"
    rm -f "$EXPECTED_PIXELS" "$EXPECTED_ALPHA" "$ACTUAL_OUTPUT"
+   rm -f "$PACKED_OUTPUT" "$RAW_OUTPUT" "$MANIFEST"
+   rm -rf "$CACHE_DIR"
    exit 1
 }
 
@@ -84,6 +90,53 @@ check_output "$LINENO: file in + stdout"
 cat "$INPUT_IMAGE" | "./$TOOL" - - > "$ACTUAL_OUTPUT"
 check_output "$LINENO: stdin + stdout"
 
+# Packed output is checked by dithering it again without "-p".  Dithering
+# is idempotent for black and white pixels, so this converts the packed
+# output to 8bit gray plus 8bit alpha without changing the pixel values.
+"./$TOOL" -p "$INPUT_IMAGE" "$PACKED_OUTPUT"
+"./$TOOL" "$PACKED_OUTPUT" "$ACTUAL_OUTPUT"
+check_output "$LINENO: packed file out"
+
+cat "$INPUT_IMAGE" | "./$TOOL" -p - - > "$PACKED_OUTPUT"
+"./$TOOL" "$PACKED_OUTPUT" "$ACTUAL_OUTPUT"
+check_output "$LINENO: packed stdout"
+
+# Raw output is checked by dithering it again to PNG, which also tests
+# reading raw input from memory mapped file and from stdin.
+"./$TOOL" "$INPUT_IMAGE" "$RAW_OUTPUT"
+"./$TOOL" "$RAW_OUTPUT" "$ACTUAL_OUTPUT"
+check_output "$LINENO: raw file out"
+
+cat "$INPUT_IMAGE" | "./$TOOL" -p - "$RAW_OUTPUT"
+cat "$RAW_OUTPUT" | "./$TOOL" - - > "$ACTUAL_OUTPUT"
+check_output "$LINENO: packed raw out + raw stdin"
+
+head -c 20 "$RAW_OUTPUT" | "./$TOOL" - "$ACTUAL_OUTPUT" 2> /dev/null \
+   && die "$LINENO: unexpected success"
+
+# First run populates the cache, and the next run with the same input
+# contents is served from cache, even if input comes from stdin.  Packed
+# output uses a different cache entry.
+rm -f "$ACTUAL_OUTPUT"
+TOOL_CACHE_DIR="$CACHE_DIR" "./$TOOL" "$INPUT_IMAGE" "$ACTUAL_OUTPUT"
+check_output "$LINENO: cache miss"
+if [[ $(ls "$CACHE_DIR" | wc -l) -ne 1 ]]; then
+   die "$LINENO: expected 1 cache entry"
+fi
+rm -f "$ACTUAL_OUTPUT"
+cat "$INPUT_IMAGE" \
+   | TOOL_CACHE_DIR="$CACHE_DIR" "./$TOOL" - "$ACTUAL_OUTPUT"
+check_output "$LINENO: cache hit"
+if [[ $(ls "$CACHE_DIR" | wc -l) -ne 1 ]]; then
+   die "$LINENO: expected 1 cache entry"
+fi
+TOOL_CACHE_DIR="$CACHE_DIR" "./$TOOL" -p "$INPUT_IMAGE" "$PACKED_OUTPUT"
+"./$TOOL" "$PACKED_OUTPUT" "$ACTUAL_OUTPUT"
+check_output "$LINENO: packed cache miss"
+if [[ $(ls "$CACHE_DIR" | wc -l) -ne 2 ]]; then
+   die "$LINENO: expected 2 cache entries"
+fi
+
 # ................................................................
 # Test dither pattern.
 
@@ -427,8 +480,58 @@ EOT
 "./$TOOL" "$INPUT_IMAGE" "$ACTUAL_OUTPUT"
 check_output "$LINENO: rgb"
 
+# ................................................................
+# Test manifest.  Both jobs crop from the same input, and dither pattern
+# is keyed on output coordinates.
+
+ppmmake rgb:80/80/80 8 8 | pnmtopng > "$INPUT_IMAGE"
+cat <<EOT > "$MANIFEST"
+# Comments and blank lines are ignored.
+
+$INPUT_IMAGE 4x4+1+0 $ACTUAL_OUTPUT
+$INPUT_IMAGE 2x2+3+3 $PACKED_OUTPUT
+EOT
+"./$TOOL" -m "$MANIFEST"
+cat <<EOT > "$EXPECTED_PIXELS"
+P1
+4 4
+1 0 1 0
+0 1 0 1
+1 0 1 0
+0 1 0 1
+EOT
+cat <<EOT > "$EXPECTED_ALPHA"
+P1
+4 4
+0 0 0 0
+0 0 0 0
+0 0 0 0
+0 0 0 0
+EOT
+check_output "$LINENO: manifest job 1"
+
+cp "$PACKED_OUTPUT" "$ACTUAL_OUTPUT"
+cat <<EOT > "$EXPECTED_PIXELS"
+P1
+2 2
+1 0
+0 1
+EOT
+cat <<EOT > "$EXPECTED_ALPHA"
+P1
+2 2
+0 0
+0 0
+EOT
+check_output "$LINENO: manifest job 2"
+
+echo "$INPUT_IMAGE 9x1+0+0 $ACTUAL_OUTPUT" \
+   | "./$TOOL" -m - > /dev/null && die "$LINENO: unexpected success"
+
 # ................................................................
 # Cleanup.
 rm -f "$INPUT_PIXELS" "$INPUT_ALPHA" "$INPUT_IMAGE"
 rm -f "$EXPECTED_PIXELS" "$EXPECTED_ALPHA" "$ACTUAL_OUTPUT"
+rm -f "$PACKED_OUTPUT" "$RAW_OUTPUT" "$MANIFEST"
+rm -rf "$CACHE_DIR"
 exit 0
@@ -0,0 +1,82 @@
+#!/bin/bash
+# Check simulate_game.exe against simulate_game() results logged by
+# main.lua, using the most recent experiment in simulation_experiments.log.
+
+if [[ $# -ne 1 ]]; then
+   echo "$0 {simulate_game.exe}"
+   exit 1
+fi
+TOOL=$1
+TEST_DIR=$(mktemp -d)
+LOG=$(dirname "$0")/simulation_experiments.log
+
+# Number of games to check.  This covers a few respawns.
+GAME_COUNT=20
+
+set -euo pipefail
+
+function die
+{
+   echo "$1"
+   rm -rf "$TEST_DIR"
+   exit 1
+}
+
+# Extract expected output from log: start from the last experiment header,
+# keep the first GAME_COUNT games, and strip timestamps.
+START=$(grep -n '^# {{{' "$LOG" | tail -n 1 | cut -d: -f1)
+tail -n "+$START" "$LOG" \
+   | grep '^\[' \
+   | sed -e 's/^\[[^]]*\]: //' \
+   | awk -v n=$GAME_COUNT '/^simulate_game\(/ {g++} g <= n' \
+   > "$TEST_DIR/expected.txt"
+RESULT_COUNT=$(grep -c 'wins, steps' "$TEST_DIR/expected.txt")
+if [[ $RESULT_COUNT -ne $GAME_COUNT ]]; then
+   die "$LINENO: failed to extract expected results from $LOG"
+fi
+
+# Single thread.
+"./$TOOL" -v 1 $GAME_COUNT \
+   | sed -e 's/^\[[^]]*\]: //' > "$TEST_DIR/actual.txt"
+if ! ( diff "$TEST_DIR/expected.txt" "$TEST_DIR/actual.txt" ); then
+   die "$LINENO: output mismatched"
+fi
+
+# Multiple threads.
+"./$TOOL" -v -j 3 1 $GAME_COUNT \
+   | sed -e 's/^\[[^]]*\]: //' > "$TEST_DIR/actual.txt"
+if ! ( diff "$TEST_DIR/expected.txt" "$TEST_DIR/actual.txt" ); then
+   die "$LINENO: output mismatched with multiple threads"
+fi
+
+# Indexed victim search checked against linear scan.
+"./$TOOL" -v -c 1 $GAME_COUNT \
+   | sed -e 's/^\[[^]]*\]: //' > "$TEST_DIR/actual.txt"
+if ! ( diff "$TEST_DIR/expected.txt" "$TEST_DIR/actual.txt" ); then
+   die "$LINENO: output mismatched with victim search check"
+fi
+
+# Summary mode: win counts should match the log, and everything except
+# timing should be independent of thread count.
+for KIND in rock paper scissors; do
+   grep -c "^$KIND wins" "$TEST_DIR/expected.txt" \
+      | sed -e "s/^/${KIND}_wins,/" >> "$TEST_DIR/expected_wins.txt" \
+      || true
+done
+"./$TOOL" --games $GAME_COUNT \
+   | grep -v '^\(threads\|seconds\|games_per_second\),' \
+   > "$TEST_DIR/summary1.txt"
+grep '_wins,' "$TEST_DIR/summary1.txt" > "$TEST_DIR/actual_wins.txt"
+if ! ( diff "$TEST_DIR/expected_wins.txt" "$TEST_DIR/actual_wins.txt" ); then
+   die "$LINENO: summary mismatched"
+fi
+"./$TOOL" --threads 3 --seed 1 --games $GAME_COUNT \
+   | grep -v '^\(threads\|seconds\|games_per_second\),' \
+   > "$TEST_DIR/summary3.txt"
+if ! ( diff "$TEST_DIR/summary1.txt" "$TEST_DIR/summary3.txt" ); then
+   die "$LINENO: summary mismatched with multiple threads"
+fi
+
+# Cleanup.
+rm -rf "$TEST_DIR"
+exit 0
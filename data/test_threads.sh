@@ -0,0 +1,102 @@
+#!/bin/bash
+# Check that multithreaded tools produce the same output regardless of
+# thread count.  Uses raw GA8 images (see image_io.h) so that it doesn't
+# depend on netpbm.
+
+if [[ $# -ne 4 ]]; then
+   echo "$0 {fs_dither.exe} {tile_dither.exe} {random_dither.exe}" \
+        "{generate_test_floor_map.exe}"
+   exit 1
+fi
+FS_DITHER=$1
+TILE_DITHER=$2
+RANDOM_DITHER=$3
+FLOOR_MAP=$4
+TEST_DIR=$(mktemp -d)
+
+# Thread counts to compare against single thread output.
+THREAD_COUNTS="2 3 7"
+
+set -euo pipefail
+
+function die
+{
+   echo "$1"
+   rm -rf "$TEST_DIR"
+   exit 1
+}
+
+# Write raw GA8 image filled with pseudorandom pixels.  Roughly a quarter
+# of the pixels are fully transparent, so that color masking is also
+# exercised.
+function noise_image
+{
+   local width=$1
+   local height=$2
+   perl -e 'srand(1);
+            print "\x89GA8", pack("V3", 1, $ARGV[0], $ARGV[1]);
+            for(1 .. $ARGV[0] * $ARGV[1])
+            {
+               print pack("CC", int(rand(256)),
+                          rand() < 0.25 ? 0 : int(rand(256)));
+            }' "$width" "$height"
+}
+
+# Run a tool with "-j 1" and other thread counts, and compare outputs.
+# First argument is a label for error messages, and the remaining
+# arguments are passed to the tool, with "{j}" replaced by thread count
+# and "{out}" replaced by output filename.
+function check_threads
+{
+   local label=$1
+   local threads arg
+   local -a args
+   shift
+   for threads in 1 $THREAD_COUNTS; do
+      args=()
+      for arg in "$@"; do
+         arg=${arg//\{j\}/$threads}
+         args+=("${arg//\{out\}/$TEST_DIR/output_$threads.ga8}")
+      done
+      "${args[@]}" || die "$label: failed with $threads threads: $?"
+      if [[ $threads -ne 1 ]] && \
+         ! cmp -s "$TEST_DIR/output_1.ga8" \
+                  "$TEST_DIR/output_$threads.ga8"; then
+         die "$label: output mismatched with $threads threads"
+      fi
+   done
+}
+
+# Image height is not a multiple of fs_dither's block size (128 rows) or
+# random_dither's band size (64 rows), so that the last partial block is
+# also covered.  Width spans many fs_dither spans (32 pixels), so that
+# scanlines have to wait for the ones above them.
+INPUT="$TEST_DIR/input.ga8"
+noise_image 1000 300 > "$INPUT"
+
+check_threads fs_dither "./$FS_DITHER" -j "{j}" "$INPUT" "{out}"
+
+# Verify that "-j" output matches output without "-j".
+"./$FS_DITHER" "$INPUT" "$TEST_DIR/default.ga8" \
+   || die "fs_dither: failed without -j: $?"
+cmp -s "$TEST_DIR/default.ga8" "$TEST_DIR/output_1.ga8" \
+   || die "fs_dither: output mismatched without -j"
+
+check_threads random_dither "./$RANDOM_DITHER" -j "{j}" "$INPUT" "{out}"
+
+# tile_dither needs image size to be a multiple of tile size.  20 tiles
+# per row doesn't divide evenly by 3 or 7 threads.
+INPUT="$TEST_DIR/tile_input.ga8"
+noise_image 320 208 > "$INPUT"
+check_threads tile_dither "./$TILE_DITHER" -j "{j}" 16 "$INPUT" "{out}"
+
+# Floor map needs a full tile table.  Map height is not a multiple of any
+# of the thread counts.
+INPUT="$TEST_DIR/floor_tiles.ga8"
+noise_image 1024 1024 > "$INPUT"
+check_threads floor_map "./$FLOOR_MAP" --seed 1 --hash --threads "{j}" \
+   --width 5 --height 11 "$INPUT" "{out}"
+
+# Cleanup.
+rm -rf "$TEST_DIR"
+exit 0
@@ -2,10 +2,14 @@
 
    Usage:
 
-      ./tile_dither {tile_size} {input.png} {output.png}
+      ./tile_dither [-j {threads}] {tile_size} {input.png} {output.png}
 
    Use "-" for input or output to read/write from stdin/stdout.
 
+   With "-j", tiles within each row of tiles are dithered in parallel
+   using the specified number of threads.  Since tiles are independent of
+   each other, output is identical regardless of thread count.
+
    Given a grayscale (8bit) plus alpha (8bit) PNG, output a black and
    white (1bit) plus transparency (1bit) PNG, with Floyd-Steinberg dithering.
 
@@ -20,11 +24,12 @@
    is counter-productive.
 */
 
-#include<png.h>
 #include<stdio.h>
 #include<stdlib.h>
 #include<string.h>
 #include<unistd.h>
+#include"image_io.h"
+#include"worker_pool.h"
 
 #ifdef _WIN32
    #include<fcntl.h>
@@ -70,23 +75,94 @@ static void DitherTile(int tile_size,
    }
 }
 
-int main(int argc, char **argv)
+/* Maximum number of threads for "-j". */
+#define MAX_THREADS  MAX_POOL_THREADS
+
+/* Per-worker state for dithering one row of tiles. */
+typedef struct
 {
-   png_image image;
-   png_bytep pixels, p;
-   int tile_size, x, y;
+   /* Tile settings, shared by all workers. */
+   int tile_size;
+   int image_width;
+   int thread_count;
+
+   /* Index of first tile to be processed by this worker.  Each worker
+      processes every thread_count'th tile starting from this index.   */
+   int first_tile;
+
+   /* Error buffers owned by this thread. */
    int *row_error[2];
 
-   if( argc != 4 )
-      return printf("%s {tile_size} {input.png} {output.png}\n", *argv);
-   tile_size = atoi(argv[1]);
+   /* Pixels for the current row of tiles, shared by all threads. */
+   png_bytep band;
+} Worker;
+
+/* Dither all tiles assigned to a single worker.  "context" is the array
+   of all workers.                                                      */
+static void DitherTiles(void *context, int worker)
+{
+   Worker *w = (Worker*)context + worker;
+   const int stride = w->thread_count * w->tile_size;
+   int x, ty, tx;
+   png_bytep p;
+
+   for(x = w->first_tile * w->tile_size; x < w->image_width; x += stride)
+   {
+      /* Dither colors and alpha channel independently. */
+      p = w->band + x * 2;
+      DitherTile(w->tile_size, w->image_width, w->row_error, p);
+      DitherTile(w->tile_size, w->image_width, w->row_error, p + 1);
+
+      /* Set color to zero if the corresponding alpha is zero. */
+      for(ty = 0; ty < w->tile_size; ty++)
+      {
+         p = w->band + (ty * w->image_width + x) * 2;
+         for(tx = 0; tx < w->tile_size; tx++, p += 2)
+         {
+            if( *(p + 1) == 0 )
+               *p = 0;
+         }
+      }
+   }
+}
+
+int main(int argc, char **argv)
+{
+   ImageReader reader;
+   ImageWriter writer;
+   Worker workers[MAX_THREADS];
+   WorkerPool pool;
+   const char *input, *output;
+   png_bytep band;
+   int tile_size, thread_count, arg, x, y, band_y;
+
+   thread_count = 1;
+   arg = 1;
+   if( argc == 6 && strcmp(argv[1], "-j") == 0 )
+   {
+      thread_count = atoi(argv[2]);
+      if( thread_count < 1 || thread_count > MAX_THREADS )
+      {
+         printf("Invalid thread count: %s\n", argv[2]);
+         return 1;
+      }
+      arg = 3;
+   }
+   if( argc != arg + 3 )
+   {
+      return printf("%s [-j {threads}] {tile_size} {input.png} {output.png}\n",
+                    *argv);
+   }
+   tile_size = atoi(argv[arg]);
    if( tile_size < 2 )
    {
-      printf("Invalid tile size: %s\n", argv[1]);
+      printf("Invalid tile size: %s\n", argv[arg]);
       return 1;
    }
+   input = argv[arg + 1];
+   output = argv[arg + 2];
 
-   if( strcmp(argv[3], "-") == 0 && isatty(STDOUT_FILENO) )
+   if( strcmp(output, "-") == 0 && isatty(STDOUT_FILENO) )
    {
       fputs("Not writing output to stdout because it's a tty\n", stderr);
       return 1;
@@ -96,97 +172,130 @@ int main(int argc, char **argv)
       setmode(STDOUT_FILENO, O_BINARY);
    #endif
 
-   /* Load input. */
-   memset(&image, 0, sizeof(image));
-   image.version = PNG_IMAGE_VERSION;
-   if( strcmp(argv[2], "-") == 0 )
+   /* Open input. */
+   if( !OpenImageReader(&reader, input) )
    {
-      if( !png_image_begin_read_from_stdio(&image, stdin) )
+      if( strcmp(input, "-") == 0 )
          return puts("Error reading from stdin");
-   }
-   else
-   {
-      if( !png_image_begin_read_from_file(&image, argv[2]) )
-         return printf("Error reading %s\n", argv[2]);
+      return printf("Error reading %s\n", input);
    }
 
-   if( (image.width % tile_size) != 0 || (image.height % tile_size) != 0 )
+   if( (reader.width % tile_size) != 0 || (reader.height % tile_size) != 0 )
    {
       printf("Image size (%d,%d) is not a multiple of tile size (%d)\n",
-             (int)image.width, (int)image.height, tile_size);
+             reader.width, reader.height, tile_size);
+      CloseImageReader(&reader);
       return 1;
    }
-   row_error[0] = (int*)malloc((tile_size + 2) * sizeof(int));
-   row_error[1] = (int*)malloc((tile_size + 2) * sizeof(int));
-   if( row_error[0] == NULL || row_error[1] == NULL )
+
+   /* Since errors do not cross tile boundaries, we only need to hold one
+      row of tiles in memory at a time.                                  */
+   band = (png_bytep)malloc(
+      (size_t)reader.width * tile_size * IMAGE_PIXEL_SIZE);
+   if( band == NULL )
    {
-      printf("Tile size too large: %s\n", argv[1]);
-      return 1;
+      CloseImageReader(&reader);
+      return puts("Out of memory");
    }
 
-   image.format = PNG_FORMAT_GA;
-   pixels = (png_bytep)malloc(PNG_IMAGE_SIZE(image));
-   if( pixels == NULL )
-      return puts("Out of memory");
-   if( !png_image_finish_read(&image, NULL, pixels, 0, NULL) )
+   /* There is no point in having more threads than tiles per row. */
+   if( thread_count > reader.width / tile_size )
+      thread_count = reader.width / tile_size;
+
+   /* Allocate error buffers for each thread. */
+   for(x = 0; x < thread_count; x++)
    {
-      free(pixels);
-      return printf("Error loading %s\n", argv[2]);
+      workers[x].tile_size = tile_size;
+      workers[x].image_width = reader.width;
+      workers[x].thread_count = thread_count;
+      workers[x].first_tile = x;
+      workers[x].band = band;
+      workers[x].row_error[0] = (int*)malloc((tile_size + 2) * sizeof(int));
+      workers[x].row_error[1] = (int*)malloc((tile_size + 2) * sizeof(int));
+      if( workers[x].row_error[0] == NULL || workers[x].row_error[1] == NULL )
+      {
+         printf("Tile size too large: %s\n", argv[arg]);
+         CloseImageReader(&reader);
+         for(; x >= 0; x--)
+         {
+            free(workers[x].row_error[0]);
+            free(workers[x].row_error[1]);
+         }
+         free(band);
+         return 1;
+      }
    }
 
-   /* Dither tiles. */
-   for(y = 0; y < (int)image.height; y += tile_size)
+   /* Open output. */
+   if( !OpenImageWriter(&writer, output, reader.width, reader.height) )
    {
-      for(x = 0; x < (int)image.width; x += tile_size)
+      if( strcmp(output, "-") == 0 )
+         fputs("Error writing to stdout\n", stderr);
+      else
+         printf("Error writing %s\n", output);
+      CloseImageReader(&reader);
+      for(x = 0; x < thread_count; x++)
       {
-         /* Dither colors and alpha channel independently. */
-         DitherTile(tile_size,
-                    image.width,
-                    row_error,
-                    pixels + (y * image.width + x) * 2);
-         DitherTile(tile_size,
-                    image.width,
-                    row_error,
-                    pixels + (y * image.width + x) * 2 + 1);
+         free(workers[x].row_error[0]);
+         free(workers[x].row_error[1]);
       }
+      free(band);
+      return 1;
    }
 
-   /* Set color to zero if the corresponding alpha is zero. */
-   p = pixels;
-   for(y = 0; y < (int)image.height; y++)
+   /* Dither tiles. */
+   StartWorkerPool(&pool, thread_count);
+   for(y = 0; y < reader.height; y += tile_size)
    {
-      for(x = 0; x < (int)image.width; x++, p += 2)
+      for(band_y = 0; band_y < tile_size; band_y++)
       {
-         if( *(p + 1) == 0 )
-            *p = 0;
+         if( !ReadImageRow(&reader,
+                           band + band_y * reader.width * IMAGE_PIXEL_SIZE) )
+         {
+            break;
+         }
       }
+      if( band_y < tile_size )
+         break;
+
+      RunWorkerPool(&pool, DitherTiles, workers);
+
+      for(band_y = 0; band_y < tile_size; band_y++)
+      {
+         if( !WriteImageRow(&writer,
+                            band + band_y * reader.width * IMAGE_PIXEL_SIZE) )
+         {
+            break;
+         }
+      }
+      if( band_y < tile_size )
+         break;
    }
 
-   /* Write output.  Here we set the flags to optimize for encoding speed
-      rather than output size so that we can iterate faster.  This is fine
-      since the output of this tool are intermediate files that are used
-      only in the build process, and are not the final PNGs that will be
-      committed.                                                           */
-   image.flags |= PNG_IMAGE_FLAG_FAST;
+   StopWorkerPool(&pool);
+
+   /* Check for errors.  Read errors are reported here, write errors are
+      reported when closing the writer.                                 */
    x = 0;
-   if( strcmp(argv[3], "-") == 0 )
+   if( y < reader.height && reader.current_row < y + tile_size )
    {
-      if( !png_image_write_to_stdio(&image, stdout, 0, pixels, 0, NULL) )
-      {
-         fputs("Error writing to stdout\n", stderr);
-         x = 1;
-      }
+      printf("Error loading %s\n", input);
+      x = 1;
    }
-   else
+   CloseImageReader(&reader);
+   for(band_y = 0; band_y < thread_count; band_y++)
    {
-      if( !png_image_write_to_file(&image, argv[3], 0, pixels, 0, NULL) )
-      {
-         printf("Error writing %s\n", argv[3]);
-         x = 1;
-      }
+      free(workers[band_y].row_error[0]);
+      free(workers[band_y].row_error[1]);
+   }
+   free(band);
+   if( !CloseImageWriter(&writer) && x == 0 )
+   {
+      if( strcmp(output, "-") == 0 )
+         fputs("Error writing to stdout\n", stderr);
+      else
+         printf("Error writing %s\n", output);
+      x = 1;
    }
-   free(row_error[0]);
-   free(row_error[1]);
-   free(pixels);
    return x;
 }
@@ -0,0 +1,383 @@
+/* Content-addressed output cache.  See tool_cache.h for details. */
+
+#include"tool_cache.h"
+#include<errno.h>
+#include<stdint.h>
+#include<stdio.h>
+#include<stdlib.h>
+#include<string.h>
+#include<sys/stat.h>
+#include<time.h>
+#include<unistd.h>
+
+#ifdef _WIN32
+   #include<direct.h>
+   #define mkdir(path, mode)  _mkdir(path)
+#endif
+
+/* Size of buffers for reading and copying files. */
+#define BUFFER_SIZE  0x10000
+
+/* FNV-1a hash parameters (64bit). */
+#define FNV_OFFSET_BASIS  0xcbf29ce484222325ull
+#define FNV_PRIME         0x100000001b3ull
+
+/* Update hash with a block of bytes. */
+static uint64_t UpdateHash(uint64_t hash, const void *data, size_t size)
+{
+   const unsigned char *p = (const unsigned char*)data;
+   size_t i;
+
+   for(i = 0; i < size; i++)
+      hash = (hash ^ p[i]) * FNV_PRIME;
+   return hash;
+}
+
+/* Update hash with contents of a file.  If "copy" is not NULL, file
+   contents are also written there.  Returns 1 on success.            */
+static int HashFile(uint64_t *hash, FILE *infile, FILE *copy)
+{
+   unsigned char buffer[BUFFER_SIZE];
+   uint64_t total = 0;
+   size_t size;
+
+   while( (size = fread(buffer, 1, BUFFER_SIZE, infile)) > 0 )
+   {
+      *hash = UpdateHash(*hash, buffer, size);
+      total += size;
+      if( copy != NULL && fwrite(buffer, 1, size, copy) != size )
+         return 0;
+   }
+   if( ferror(infile) )
+      return 0;
+
+   /* Include file size, so that files that differ only by trailing
+      bytes are less likely to collide.                              */
+   *hash = UpdateHash(*hash, &total, sizeof(total));
+   return 1;
+}
+
+/* Update hash with contents of a named file.  Returns 1 on success. */
+static int HashNamedFile(uint64_t *hash, const char *filename)
+{
+   FILE *infile;
+   int ok;
+
+   if( (infile = fopen(filename, "rb")) == NULL )
+      return 0;
+   ok = HashFile(hash, infile, NULL);
+   fclose(infile);
+   return ok;
+}
+
+/* Hash of the most recently hashed named file, so that tools that look
+   up multiple outputs for the same input (e.g. crop_table.exe with
+   multiple crops, dither.exe manifests) only read the input once.
+   Entries are matched on path, size, and modification time.           */
+static struct
+{
+   char *path;
+   off_t size;
+   time_t mtime;
+   uint64_t hash;
+} last_file;
+
+/* Get hash of a named file's contents, reusing last_file if possible.
+   Returns 1 on success.                                               */
+static int HashInput(uint64_t *hash, const char *filename)
+{
+   struct stat st;
+
+   if( stat(filename, &st) != 0 )
+      return 0;
+   if( last_file.path != NULL && strcmp(last_file.path, filename) == 0 &&
+       last_file.size == st.st_size && last_file.mtime == st.st_mtime )
+   {
+      *hash = last_file.hash;
+      return 1;
+   }
+
+   *hash = FNV_OFFSET_BASIS;
+   if( !HashNamedFile(hash, filename) )
+      return 0;
+   free(last_file.path);
+   if( (last_file.path = strdup(filename)) != NULL )
+   {
+      last_file.size = st.st_size;
+      last_file.mtime = st.st_mtime;
+      last_file.hash = *hash;
+   }
+   return 1;
+}
+
+/* Allocate a formatted string.  Returns NULL if out of memory. */
+static char *FormatPath(const char *dir, uint64_t key, const char *suffix)
+{
+   const size_t size = strlen(dir) + strlen(suffix) + 64;
+   char *path = (char*)malloc(size);
+
+   if( path != NULL )
+   {
+      snprintf(path, size, "%s/%016llx%s",
+               dir, (unsigned long long)key, suffix);
+   }
+   return path;
+}
+
+/* Get filename extension including the dot, or ".png" if output doesn't
+   have an extension.  Cache entries use the same extension as the final
+   output, since tools pick output format based on filename.             */
+static const char *GetExtension(const char *filename)
+{
+   const char *dot = strrchr(filename, '.');
+   const char *slash = strrchr(filename, '/');
+
+   if( dot == NULL || (slash != NULL && dot < slash) )
+      return ".png";
+   return dot;
+}
+
+/* Check if two open files have the same contents. */
+static int SameContents(FILE *a, FILE *b)
+{
+   unsigned char buffer_a[BUFFER_SIZE], buffer_b[BUFFER_SIZE];
+   size_t size_a, size_b;
+
+   do
+   {
+      size_a = fread(buffer_a, 1, BUFFER_SIZE, a);
+      size_b = fread(buffer_b, 1, BUFFER_SIZE, b);
+      if( size_a != size_b || memcmp(buffer_a, buffer_b, size_a) != 0 )
+         return 0;
+   } while( size_a > 0 );
+   return !ferror(a) && !ferror(b);
+}
+
+/* Copy cache entry to output.  If output is a file that already has the
+   same contents, it's not modified.  Returns 1 on success.             */
+static int CopyEntry(const char *entry, const char *output)
+{
+   unsigned char buffer[BUFFER_SIZE];
+   FILE *infile, *outfile;
+   size_t size;
+   int ok;
+
+   if( (infile = fopen(entry, "rb")) == NULL )
+      return 0;
+
+   if( strcmp(output, "-") == 0 )
+   {
+      outfile = stdout;
+   }
+   else
+   {
+      if( (outfile = fopen(output, "rb")) != NULL )
+      {
+         ok = SameContents(infile, outfile);
+         fclose(outfile);
+         if( ok )
+         {
+            fclose(infile);
+            return 1;
+         }
+         rewind(infile);
+      }
+      if( (outfile = fopen(output, "wb")) == NULL )
+      {
+         fclose(infile);
+         return 0;
+      }
+   }
+
+   ok = 1;
+   while( (size = fread(buffer, 1, BUFFER_SIZE, infile)) > 0 )
+   {
+      if( fwrite(buffer, 1, size, outfile) != size )
+      {
+         ok = 0;
+         break;
+      }
+   }
+   if( ferror(infile) )
+      ok = 0;
+   fclose(infile);
+   if( outfile == stdout )
+   {
+      if( fflush(stdout) != 0 )
+         ok = 0;
+   }
+   else
+   {
+      if( fclose(outfile) != 0 )
+         ok = 0;
+      if( !ok )
+         remove(output);
+   }
+   return ok;
+}
+
+/* Release all memory held by cache, and reset it to the disabled state
+   with the specified input and output paths.                          */
+static void ResetCache(ToolCache *cache, const char *input,
+                       const char *output)
+{
+   free(cache->entry);
+   free(cache->temp_input);
+   free(cache->temp_output);
+   memset(cache, 0, sizeof(ToolCache));
+   cache->input = input;
+   cache->output = output;
+}
+
+int OpenToolCache(ToolCache *cache,
+                  const char *tool,
+                  const char *options,
+                  const char *input,
+                  const char *output)
+{
+   const char *dir = getenv("TOOL_CACHE_DIR");
+   static uint64_t tool_hash = 0;
+   static int temp_serial = 0;
+   char suffix[64];
+   uint64_t key, input_hash;
+   FILE *copy;
+   struct stat entry_stat;
+   int ok;
+
+   memset(cache, 0, sizeof(ToolCache));
+   cache->input = input;
+   cache->output = output;
+   if( dir == NULL || *dir == '\0' )
+      return 1;
+
+   if( strcmp(output, "-") == 0 && isatty(STDOUT_FILENO) )
+   {
+      fputs("Not writing output to stdout because it's a tty\n", stderr);
+      return 0;
+   }
+   if( mkdir(dir, 0777) != 0 && errno != EEXIST )
+   {
+      fprintf(stderr, "Error creating %s\n", dir);
+      return 0;
+   }
+
+   /* Hash the tool itself, so that rebuilding a tool with different
+      behavior invalidates its old entries.  If we can't find our own
+      executable, run without cache rather than risking stale output.
+      The executable doesn't change while we are running, so its hash
+      is computed only once.                                           */
+   if( tool_hash == 0 )
+   {
+      tool_hash = FNV_OFFSET_BASIS;
+      if( !HashNamedFile(&tool_hash, "/proc/self/exe") )
+      {
+         tool_hash = FNV_OFFSET_BASIS;
+         if( !HashNamedFile(&tool_hash, tool) )
+         {
+            fprintf(stderr, "%s: executable not found, cache disabled\n",
+                    tool);
+            tool_hash = 0;
+            return 1;
+         }
+      }
+   }
+
+   /* Cache key combines the tool hash, options (including terminating
+      NUL), and the input hash.                                        */
+   key = UpdateHash(FNV_OFFSET_BASIS, &tool_hash, sizeof(tool_hash));
+   key = UpdateHash(key, options, strlen(options) + 1);
+
+   /* Hash input.  Stdin can only be read once, so we save a copy of it
+      for the tool to read from.                                       */
+   snprintf(suffix, sizeof(suffix), ".%ld.in", (long)getpid());
+   if( strcmp(input, "-") == 0 )
+   {
+      cache->temp_input = FormatPath(dir, 0, suffix);
+      if( cache->temp_input == NULL )
+      {
+         fputs("Out of memory\n", stderr);
+         ResetCache(cache, input, output);
+         return 0;
+      }
+      if( (copy = fopen(cache->temp_input, "wb")) == NULL )
+      {
+         fprintf(stderr, "Error writing %s\n", cache->temp_input);
+         ResetCache(cache, input, output);
+         return 0;
+      }
+      input_hash = FNV_OFFSET_BASIS;
+      ok = HashFile(&input_hash, stdin, copy);
+      if( fclose(copy) != 0 )
+         ok = 0;
+      if( !ok )
+      {
+         fputs("Error reading from stdin\n", stderr);
+         remove(cache->temp_input);
+         ResetCache(cache, input, output);
+         return 0;
+      }
+      cache->input = cache->temp_input;
+   }
+   else if( !HashInput(&input_hash, input) )
+   {
+      fprintf(stderr, "Error reading %s\n", input);
+      return 0;
+   }
+   key = UpdateHash(key, &input_hash, sizeof(input_hash));
+
+   /* Check for existing entry. */
+   cache->final_output = output;
+   cache->entry = FormatPath(dir, key, GetExtension(output));
+   /* Temporary output name includes a serial number in addition to
+      process ID, since the same key may be opened more than once by a
+      single process (e.g. repeated crops or manifest lines).          */
+   snprintf(suffix, sizeof(suffix), ".%ld.%d%.16s",
+            (long)getpid(), temp_serial++, GetExtension(output));
+   cache->temp_output = FormatPath(dir, key, suffix);
+   if( cache->entry == NULL || cache->temp_output == NULL )
+   {
+      fputs("Out of memory\n", stderr);
+      if( cache->temp_input != NULL )
+         remove(cache->temp_input);
+      ResetCache(cache, input, output);
+      return 0;
+   }
+   cache->hit = stat(cache->entry, &entry_stat) == 0 &&
+                entry_stat.st_size > 0;
+   cache->output = cache->temp_output;
+   return 1;
+}
+
+int CloseToolCache(ToolCache *cache, int status)
+{
+   if( cache->entry == NULL )
+      return status;
+
+   if( cache->temp_input != NULL )
+      remove(cache->temp_input);
+
+   if( status == 0 && !cache->hit )
+   {
+      /* Insert new entry.  On some platforms, rename fails if target
+         already exists, which is fine since that means some other
+         process has inserted the same entry.                         */
+      if( rename(cache->temp_output, cache->entry) != 0 )
+         remove(cache->temp_output);
+   }
+   else
+   {
+      remove(cache->temp_output);
+   }
+
+   if( status == 0 && !CopyEntry(cache->entry, cache->final_output) )
+   {
+      if( strcmp(cache->final_output, "-") == 0 )
+         fputs("Error writing to stdout\n", stderr);
+      else
+         fprintf(stderr, "Error writing %s\n", cache->final_output);
+      status = 1;
+   }
+
+   ResetCache(cache, NULL, NULL);
+   return status;
+}
@@ -0,0 +1,86 @@
+/* Content-addressed output cache shared by data tools.
+
+   Most of our images come from a few master SVGs, so editing a single
+   layer updates the timestamps of all images derived from that SVG, and
+   make will rerun every downstream tool even if its input didn't change.
+   svg_to_png.sh avoids rerunning Inkscape by caching output keyed on the
+   hash of input contents.  This library does the same for C tools that
+   produce one output file from one input file.
+
+   Cache is off by default.  It's enabled by setting TOOL_CACHE_DIR
+   environment variable to a directory, which will be created if needed:
+
+      make TOOL_CACHE_DIR=t_tool_cache
+
+   Cache key is a hash of the tool executable itself, a string describing
+   the options that affect output, and the input contents.  Input and
+   output filenames are not part of the key, and neither are options that
+   don't affect output (e.g. thread count).  Within a single process,
+   the tool hash and the hash of the last named input are computed only
+   once, so looking up several outputs of the same input is cheap.
+
+   Cache entries have the same filename extension as the output, so a
+   tool that writes raw images (see image_io.h) gets raw cache entries.
+
+   On cache hit, the cached output is copied to output path, unless output
+   already has the same contents, in which case it's left untouched so
+   that make doesn't rebuild the targets that depend on it.  On cache
+   miss, the tool writes its output to a temporary file in the cache
+   directory, which is then renamed to the cache entry.  Rename is atomic,
+   so concurrent tools (e.g. with "make -j") will never see partially
+   written cache entries.  If two tools produce the same entry at the same
+   time, both write identical contents, and either one may win.
+
+   Usage:
+
+      ToolCache cache;
+      if( !OpenToolCache(&cache, argv[0], options, input_path, output_path) )
+         ...error...
+      if( !cache.hit )
+         status = RunTool(cache.input, cache.output);
+      return CloseToolCache(&cache, status);
+
+   "-" means stdin or stdout, same as image_io.  If input is stdin, it's
+   copied to a temporary file while hashing, and cache.input will point at
+   that file.
+*/
+
+#ifndef TOOL_CACHE_H_
+#define TOOL_CACHE_H_
+
+typedef struct
+{
+   /* Paths that the tool should read input from and write output to.
+      These are the same as the paths passed to OpenToolCache if cache
+      is disabled.                                                      */
+   const char *input;
+   const char *output;
+
+   /* 1 if output was found in cache, in which case the tool doesn't need
+      to produce any output.                                             */
+   int hit;
+
+   /* Internal state.  All paths are NULL if cache is disabled. */
+   const char *final_output;
+   char *entry;
+   char *temp_input;
+   char *temp_output;
+} ToolCache;
+
+/* Look up cache entry for a tool invocation.  "tool" is argv[0], and
+   "options" is any string that uniquely describes the settings that
+   affect output.  Returns 1 on success, or 0 on error after printing an
+   error message.                                                       */
+int OpenToolCache(ToolCache *cache,
+                  const char *tool,
+                  const char *options,
+                  const char *input,
+                  const char *output);
+
+/* Finish a tool invocation.  "status" is the exit status of the tool,
+   where zero means success.  On success, output is inserted into cache
+   (if it wasn't a hit) and copied to its final destination.  Returns
+   updated exit status.  Temporary files are removed in all cases.      */
+int CloseToolCache(ToolCache *cache, int status);
+
+#endif
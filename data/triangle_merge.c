@@ -30,18 +30,50 @@
 
    Well, the end result is that in addition to the visible tile seams at
    the 4 edges, we also get a diagonal seam.
+
+   Both inputs are streamed one scanline at a time, so memory usage is
+   proportional to image width.  Which pixels come from the second image
+   only depends on x % tile_size and y % tile_size, so the tile column of
+   each pixel is computed once, and each scanline builds a byte mask from
+   it and blends the two rows without branches.
 */
 
-#include<png.h>
 #include<stdio.h>
 #include<stdlib.h>
 #include<string.h>
+#include"image_io.h"
+
+/* Build selection mask for a scanline, with 0xff for each byte that
+   should come from the second image.  "column" holds x % tile_size for
+   each output byte, and "row_phase" is y % tile_size.                  */
+static void BuildRowMask(const int *column, int byte_count,
+                         int tile_size, int row_phase, png_bytep mask)
+{
+   const int threshold = tile_size - row_phase;
+   int i;
+
+   for(i = 0; i < byte_count; i++)
+      mask[i] = column[i] >= threshold ? 0xff : 0;
+}
+
+/* Copy masked bytes from "source" to "target". */
+static void BlendRow(png_bytep target, png_const_bytep source,
+                     png_const_bytep mask, int byte_count)
+{
+   int i;
+
+   for(i = 0; i < byte_count; i++)
+      target[i] = (png_byte)((target[i] & ~mask[i]) | (source[i] & mask[i]));
+}
 
 int main(int argc, char **argv)
 {
-   png_image image[2];
-   png_bytep pixels[2], r, w;
-   int tile_size, i, x, y;
+   ImageReader reader[2];
+   ImageWriter writer;
+   png_bytep row, mask;
+   png_const_bytep source;
+   int *column;
+   int tile_size, byte_count, i, y, status;
 
    if( argc != 5 )
    {
@@ -55,74 +87,99 @@ int main(int argc, char **argv)
       return 1;
    }
 
-   /* Load input. */
-   pixels[0] = pixels[1] = NULL;
+   /* Open input.  Both inputs are read in lockstep one scanline at a
+      time, so we don't need to hold either image in memory.          */
+   memset(reader, 0, sizeof(reader));
+   row = mask = NULL;
+   column = NULL;
    for(i = 0; i < 2; i++)
    {
-      memset(&image[i], 0, sizeof(image[0]));
-      image[i].version = PNG_IMAGE_VERSION;
-      if( !png_image_begin_read_from_file(&image[i], argv[i + 2]) )
+      if( !OpenImageReader(&reader[i], argv[i + 2]) )
       {
          printf("Error reading %s\n", argv[i + 2]);
          goto fail;
       }
-
-      image[i].format = PNG_FORMAT_GA;
-      pixels[i] = (png_bytep)malloc(PNG_IMAGE_SIZE(image[0]));
-      if( pixels[i] == NULL )
-      {
-         puts("Out of memory");
-         goto fail;
-      }
-      if( !png_image_finish_read(&image[i], NULL, pixels[i], 0, NULL) )
-      {
-         printf("Error loading %s\n", argv[i + 2]);
-         goto fail;
-      }
    }
 
    /* Check dimensions. */
-   if( image[0].width != image[1].width || image[0].height != image[1].height )
+   if( reader[0].width != reader[1].width ||
+       reader[0].height != reader[1].height )
    {
       printf("Image dimensions mismatched.  %s=(%d,%d), %s=(%d,%d)\n",
-             argv[2], (int)image[0].width, (int)image[0].height,
-             argv[3], (int)image[1].width, (int)image[1].height);
+             argv[2], reader[0].width, reader[0].height,
+             argv[3], reader[1].width, reader[1].height);
+      goto fail;
+   }
+
+   /* First input is read into a writable buffer that becomes the output
+      row, and second input is read in place with GetImageRow.           */
+   byte_count = reader[0].width * IMAGE_PIXEL_SIZE;
+   row = (png_bytep)malloc(byte_count);
+   mask = (png_bytep)malloc(byte_count);
+   column = (int*)malloc(byte_count * sizeof(int));
+   if( row == NULL || mask == NULL || column == NULL )
+   {
+      puts("Out of memory");
+      goto fail;
+   }
+   for(i = 0; i < byte_count; i++)
+      column[i] = (i / IMAGE_PIXEL_SIZE) % tile_size;
+
+   /* Open output. */
+   if( !OpenImageWriter(&writer, argv[4], reader[0].width, reader[0].height) )
+   {
+      printf("Error writing %s\n", argv[4]);
       goto fail;
    }
 
    /* Copy selected regions from second image into the first image. */
-   r = pixels[1];
-   w = pixels[0];
-   for(y = 0; y < (int)image[0].height; y++)
+   status = 0;
+   for(y = 0; y < reader[0].height; y++)
    {
+      if( !ReadImageRow(&reader[0], row) )
+      {
+         printf("Error loading %s\n", argv[2]);
+         status = 1;
+         break;
+      }
+      if( (source = GetImageRow(&reader[1])) == NULL )
+      {
+         printf("Error loading %s\n", argv[3]);
+         status = 1;
+         break;
+      }
+
+      /* Top row of each tile comes entirely from the first image. */
       i = y % tile_size;
-      for(x = 0; x < (int)image[0].width; x++, r += 2, w += 2)
+      if( i != 0 )
       {
-         if( i + (x % tile_size) >= tile_size )
-         {
-            *w = *r;
-            *(w + 1) = *(r + 1);
-         }
+         BuildRowMask(column, byte_count, tile_size, i, mask);
+         BlendRow(row, source, mask, byte_count);
       }
-   }
 
-   /* Write output.  Here we set the flags to optimize for encoding speed
-      rather than output size so that we can iterate faster.  This is fine
-      since the output of this tool are intermediate files that are used
-      only in the build process, and are not the final PNGs that will be
-      committed.                                                           */
-   image[0].flags |= PNG_IMAGE_FLAG_FAST;
-   if( !png_image_write_to_file(&image[0], argv[4], 0, pixels[0], 0, NULL) )
+      if( !WriteImageRow(&writer, row) )
+         break;
+   }
+   if( !CloseImageWriter(&writer) && status == 0 )
    {
       printf("Error writing %s\n", argv[4]);
-      goto fail;
+      status = 1;
    }
-   free(pixels[0]);
-   free(pixels[1]);
+   if( status != 0 )
+      goto fail;
+
+   CloseImageReader(&reader[0]);
+   CloseImageReader(&reader[1]);
+   free(row);
+   free(mask);
+   free(column);
    return 0;
 
 fail:
-   free(pixels[0]);
-   free(pixels[1]);
+   CloseImageReader(&reader[0]);
+   CloseImageReader(&reader[1]);
+   free(row);
+   free(mask);
+   free(column);
    return 1;
 }
@@ -0,0 +1,135 @@
+/* Wall tile shapes, shared by tools that need wall tile pixels.
+
+   Each 8x8 tile is a 64bit mask with bits set for opaque pixels.  Top
+   row is in the most significant byte, and the leftmost pixel of each row
+   is in the most significant bit of that byte, which is the same bit
+   order as 1bit bitmaps (PBM and Playdate images).
+
+   Tile index follows the scheme described in generate_wall_tiles.c:
+   bits 0..3 select which sides are walls, and bits 4..6 select one of
+   WALL_VARIATION_COUNT variations.  Each tile is the union of the edge
+   masks for its wall sides, plus a corner mask for each pair of adjacent
+   wall sides.  Adding a variation only requires adding a column to
+   kWallEdges and updating WALL_VARIATION_COUNT.
+*/
+
+#ifndef WALL_TILE_SHAPES_H_
+#define WALL_TILE_SHAPES_H_
+
+#include<stdint.h>
+
+/* Tile size in pixels. */
+#define WALL_TILE_SIZE  8
+
+/* Number of variations per adjacency pattern. */
+#define WALL_VARIATION_COUNT  8
+
+/* Index of first tile after all adjacency patterns and variations. */
+#define WALL_SOLID_TILE_INDEX  (16 * WALL_VARIATION_COUNT)
+
+/* Total number of tiles, including solid wall and debug tiles. */
+#define WALL_TILE_COUNT  (WALL_SOLID_TILE_INDEX + 3)
+
+/* Edge masks, indexed by [side][variation].  Sides are right, down, left,
+   up, matching bits 0..3 of tile index.
+
+   Even variations draw a few isolated bumps along the edge, odd
+   variations draw a solid edge with a thicker middle section.  Bits 1
+   and 2 of the variation extend the edge by one more pixel near each
+   end:
+
+   Right side, by variation index:
+      0    2    4    6    1    3    5    7
+      ..   .#   ..   .#   .#   .#   .#   .#
+      .#   .#   .#   .#   .#   .#   .#   .#
+      .#   .#   .#   .#   .#   ##   .#   ##
+      ..   ..   ..   ..   ##   ##   ##   ##
+      ..   ..   ..   ..   ##   ##   ##   ##
+      .#   .#   .#   .#   .#   .#   ##   ##
+      .#   .#   .#   .#   .#   .#   .#   .#
+      ..   ..   .#   .#   .#   .#   .#   .#
+
+   Other sides are rotations of the same patterns.                      */
+static const uint64_t kWallEdges[4][WALL_VARIATION_COUNT] =
+{
+   /* Right. */
+   {
+      0x0001010000010100ull, 0x0101010303010101ull,
+      0x0101010000010100ull, 0x0101030303010101ull,
+      0x0001010000010101ull, 0x0101010303030101ull,
+      0x0101010000010101ull, 0x0101030303030101ull,
+   },
+   /* Down. */
+   {
+      0x0000000000000066ull, 0x00000000000018ffull,
+      0x0000000000000067ull, 0x0000000000001cffull,
+      0x00000000000000e6ull, 0x00000000000038ffull,
+      0x00000000000000e7ull, 0x0000000000003cffull,
+   },
+   /* Left. */
+   {
+      0x0080800000808000ull, 0x808080c0c0808080ull,
+      0x0080800000808080ull, 0x808080c0c0c08080ull,
+      0x8080800000808000ull, 0x8080c0c0c0808080ull,
+      0x8080800000808080ull, 0x8080c0c0c0c08080ull,
+   },
+   /* Up. */
+   {
+      0x6600000000000000ull, 0xff18000000000000ull,
+      0xe600000000000000ull, 0xff38000000000000ull,
+      0x6700000000000000ull, 0xff1c000000000000ull,
+      0xe700000000000000ull, 0xff3c000000000000ull,
+   },
+};
+
+/* Corner masks for each pair of adjacent wall sides, in the order of
+   down right, down left, up left, up right.  These are the same for all
+   variations.                                                           */
+static const uint8_t kWallCornerSides[4] = {0x3, 0x6, 0xc, 0x9};
+static const uint64_t kWallCorners[4] =
+{
+   0x0000000103070f1full,
+   0x00000080c0e0f0f8ull,
+   0xf8f0e0c080000000ull,
+   0x1f0f070301000000ull,
+};
+
+/* Solid wall tile, and debug tiles for checking tile alignment (square
+   with solid outline, square with dotted outline).                     */
+static const uint64_t kWallSpecialTiles[3] =
+{
+   0xffffffffffffffffull,
+   0xff818181818181ffull,
+   0xaa01800180018055ull,
+};
+
+/* Get mask for a single tile.  Returns zero for out of range indices. */
+static inline uint64_t WallTileBits(int index)
+{
+   const int sides = index & 15;
+   const int variation = index >> 4;
+   uint64_t bits = 0;
+   int i;
+
+   if( index < 0 || index >= WALL_TILE_COUNT )
+      return 0;
+   if( index >= WALL_SOLID_TILE_INDEX )
+      return kWallSpecialTiles[index - WALL_SOLID_TILE_INDEX];
+
+   for(i = 0; i < 4; i++)
+   {
+      if( (sides & (1 << i)) != 0 )
+         bits |= kWallEdges[i][variation];
+      if( (sides & kWallCornerSides[i]) == kWallCornerSides[i] )
+         bits |= kWallCorners[i];
+   }
+   return bits;
+}
+
+/* Get a single row of a tile mask, with leftmost pixel in bit 7. */
+static inline uint8_t WallTileRow(uint64_t bits, int y)
+{
+   return (uint8_t)(bits >> ((WALL_TILE_SIZE - 1 - y) * 8));
+}
+
+#endif
@@ -0,0 +1,109 @@
+/* Persistent worker threads.  See worker_pool.h for details. */
+
+#include"worker_pool.h"
+
+/* Thread entry point.  Waits for new tasks until pool is stopped. */
+static void *WorkerLoop(void *arg)
+{
+   WorkerThread *t = (WorkerThread*)arg;
+   WorkerPool *pool = t->pool;
+   unsigned int generation = 0;
+   WorkerTask task;
+   void *context;
+
+   pthread_mutex_lock(&pool->lock);
+   for(;;)
+   {
+      while( pool->generation == generation && !pool->stop )
+         pthread_cond_wait(&pool->start, &pool->lock);
+      if( pool->stop )
+         break;
+      generation = pool->generation;
+      task = pool->task;
+      context = pool->context;
+      pthread_mutex_unlock(&pool->lock);
+
+      task(context, t->index);
+
+      pthread_mutex_lock(&pool->lock);
+      if( --pool->pending == 0 )
+         pthread_cond_signal(&pool->done);
+   }
+   pthread_mutex_unlock(&pool->lock);
+   return NULL;
+}
+
+void StartWorkerPool(WorkerPool *pool, int thread_count)
+{
+   int i;
+
+   if( thread_count < 1 )
+      thread_count = 1;
+   if( thread_count > MAX_POOL_THREADS )
+      thread_count = MAX_POOL_THREADS;
+   pool->thread_count = thread_count;
+   pool->task = NULL;
+   pool->context = NULL;
+   pool->generation = 0;
+   pool->pending = 0;
+   pool->stop = 0;
+   pthread_mutex_init(&pool->lock, NULL);
+   pthread_cond_init(&pool->start, NULL);
+   pthread_cond_init(&pool->done, NULL);
+
+   pool->threads[0].started = 0;
+   for(i = 1; i < thread_count; i++)
+   {
+      pool->threads[i].pool = pool;
+      pool->threads[i].index = i;
+      pool->threads[i].started =
+         pthread_create(&pool->threads[i].thread, NULL,
+                        WorkerLoop, &pool->threads[i]) == 0;
+   }
+}
+
+void RunWorkerPool(WorkerPool *pool, WorkerTask task, void *context)
+{
+   int i;
+
+   pthread_mutex_lock(&pool->lock);
+   pool->task = task;
+   pool->context = context;
+   pool->generation++;
+   pool->pending = 0;
+   for(i = 1; i < pool->thread_count; i++)
+      pool->pending += pool->threads[i].started;
+   pthread_cond_broadcast(&pool->start);
+   pthread_mutex_unlock(&pool->lock);
+
+   task(context, 0);
+   for(i = 1; i < pool->thread_count; i++)
+   {
+      if( !pool->threads[i].started )
+         task(context, i);
+   }
+
+   pthread_mutex_lock(&pool->lock);
+   while( pool->pending > 0 )
+      pthread_cond_wait(&pool->done, &pool->lock);
+   pthread_mutex_unlock(&pool->lock);
+}
+
+void StopWorkerPool(WorkerPool *pool)
+{
+   int i;
+
+   pthread_mutex_lock(&pool->lock);
+   pool->stop = 1;
+   pthread_cond_broadcast(&pool->start);
+   pthread_mutex_unlock(&pool->lock);
+
+   for(i = 1; i < pool->thread_count; i++)
+   {
+      if( pool->threads[i].started )
+         pthread_join(pool->threads[i].thread, NULL);
+   }
+   pthread_cond_destroy(&pool->done);
+   pthread_cond_destroy(&pool->start);
+   pthread_mutex_destroy(&pool->lock);
+}
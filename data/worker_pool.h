@@ -0,0 +1,80 @@
+/* Persistent worker threads shared by data tools.
+
+   Tools that stream images process one band of rows at a time, and most
+   of them run all threads once per band.  Creating and joining threads
+   for every band costs more than dithering a band of a small image, so
+   this library creates the threads once and reuses them for each band.
+
+   Each call to RunWorkerPool runs the same task once for each worker
+   index in [0, thread_count).  Worker 0 runs on the calling thread.  If
+   some thread could not be created, its share of work is run on the
+   calling thread after worker 0 is done, so tasks always see the same
+   set of worker indices regardless of how many threads were actually
+   started.  Tasks that divide work by worker index should not depend on
+   other workers running at the same time.
+
+   Usage:
+
+      WorkerPool pool;
+      StartWorkerPool(&pool, thread_count);
+      for(each band)
+         RunWorkerPool(&pool, Task, context);
+      StopWorkerPool(&pool);
+
+   The pool holds pointers to itself while threads are running, so it must
+   not be moved or copied between StartWorkerPool and StopWorkerPool.
+*/
+
+#ifndef WORKER_POOL_H_
+#define WORKER_POOL_H_
+
+#include<pthread.h>
+
+/* Maximum number of workers, including the calling thread. */
+#define MAX_POOL_THREADS  256
+
+/* Function run by each worker, with "worker" in [0, thread_count). */
+typedef void (*WorkerTask)(void *context, int worker);
+
+struct WorkerPool;
+
+/* Per-thread state. */
+typedef struct
+{
+   struct WorkerPool *pool;
+   pthread_t thread;
+   int index;
+
+   /* 1 if thread was created successfully. */
+   int started;
+} WorkerThread;
+
+typedef struct WorkerPool
+{
+   int thread_count;
+   WorkerThread threads[MAX_POOL_THREADS];
+
+   /* Current task, guarded by lock.  "generation" is incremented for each
+      new task, and "pending" is the number of threads that haven't
+      finished the current task.                                         */
+   pthread_mutex_t lock;
+   pthread_cond_t start;
+   pthread_cond_t done;
+   WorkerTask task;
+   void *context;
+   unsigned int generation;
+   int pending;
+   int stop;
+} WorkerPool;
+
+/* Start threads for workers 1 through thread_count-1.  thread_count is
+   clamped to [1, MAX_POOL_THREADS].                                     */
+void StartWorkerPool(WorkerPool *pool, int thread_count);
+
+/* Run task for all workers and wait for them to finish. */
+void RunWorkerPool(WorkerPool *pool, WorkerTask task, void *context);
+
+/* Stop all threads and release pool resources. */
+void StopWorkerPool(WorkerPool *pool);
+
+#endif